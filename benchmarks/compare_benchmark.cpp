@@ -0,0 +1,121 @@
+/// @file compare_benchmark.cpp
+/// @brief Benchmark test for the item comparators.
+///
+/// @author Roland Abel
+/// @date October 15, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <algorithm>
+#include <random>
+#include "benchmark/benchmark.h"
+#include "reader.h"
+#include "database.h"
+#include "utils.h"
+
+using namespace std;
+using namespace fim;
+
+/// Helper function: Creates the ranked database in random order, so that every iteration sorts the same input.
+static auto create_shuffled_database(const std::string_view &filename, const benchmark::State &state) -> database_t {
+    const auto db = data::read_csv(filename).value();
+    const auto [ranked_db, rank_counts, item_ranks] = db.rank_reduction(get_min_support(state, db.size()));
+
+    std::mt19937 gen{42};
+    std::vector<itemset_t> transactions{};
+    for (const auto &trans: ranked_db) {
+        auto items = trans.to_itemset();
+        std::ranges::shuffle(items, gen);
+        transactions.emplace_back(std::move(items));
+    }
+    std::ranges::shuffle(transactions, gen);
+
+    return database_t{itemsets_t{transactions}};
+}
+
+template<typename Sort>
+static void sort_lexicographically(benchmark::State &state, const database_t &shuffled_db, const Sort &sort) {
+    for ([[maybe_unused]] auto _: state) {
+        state.PauseTiming();
+        auto db = shuffled_db;
+        state.ResumeTiming();
+
+        sort(db);
+        benchmark::DoNotOptimize(db.items.data());
+    }
+}
+
+static void item_compare_benchmark(benchmark::State &state, const std::string_view &filename) {
+    const auto shuffled_db = create_shuffled_database(filename, state);
+    sort_lexicographically(state, shuffled_db, [](database_t &db) {
+        db.sort_lexicographically(item_compare_t{default_item_compare});
+    });
+}
+
+static void rank_compare_benchmark(benchmark::State &state, const std::string_view &filename) {
+    const auto shuffled_db = create_shuffled_database(filename, state);
+    sort_lexicographically(state, shuffled_db, [](database_t &db) { db.sort_lexicographically(rank_compare_t{}); });
+}
+
+static void radix_sort_benchmark(benchmark::State &state, const std::string_view &filename) {
+    const auto shuffled_db = create_shuffled_database(filename, state);
+    sort_lexicographically(state, shuffled_db, [](database_t &db) { db.radix_sort_lexicographically(); });
+}
+
+BENCHMARK_CAPTURE(item_compare_benchmark, "mushroom", "data/mushroom.dat")
+        ->Arg(1)
+        ->Arg(20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(rank_compare_benchmark, "mushroom", "data/mushroom.dat")
+        ->Arg(1)
+        ->Arg(20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(radix_sort_benchmark, "mushroom", "data/mushroom.dat")
+        ->Arg(1)
+        ->Arg(20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(item_compare_benchmark, "chess", "data/chess.dat")
+        ->Arg(1)
+        ->Arg(60)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(rank_compare_benchmark, "chess", "data/chess.dat")
+        ->Arg(1)
+        ->Arg(60)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(radix_sort_benchmark, "chess", "data/chess.dat")
+        ->Arg(1)
+        ->Arg(60)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(rank_compare_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(radix_sort_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,153 @@
+/// @file compressed_database_benchmark.cpp
+/// @brief Benchmarks of the prefix-compressed database: its size and mining from it with FP-Growth and Relim.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include "benchmark/benchmark.h"
+#include "reader.h"
+#include "compressed_database.h"
+#include "fp_growth.h"
+#include "relim.h"
+
+using namespace std;
+using namespace fim;
+
+/// Helper function: The minimum support given in per mille of the transactions.
+static auto get_min_support_per_mille(const benchmark::State &state, const size_t db_size) -> size_t {
+    return static_cast<size_t>(static_cast<double>(state.range(0)) * 0.001 * static_cast<double>(db_size));
+}
+
+/// Helper function: The number of bytes of the items, offsets and weights of a database.
+static auto get_csr_size(const database_t &db) -> size_t {
+    return db.items.size() * sizeof(item_t) + db.offsets.size() * sizeof(size_t) + db.weights.size() * sizeof(size_t);
+}
+
+static void compress_benchmark(benchmark::State &state, const std::string_view &filename) {
+    const auto database = data::read_csv(filename).value();
+    const auto min_support = get_min_support_per_mille(state, database.size());
+    const auto [db, item_counts, item_ranks] = database.rank_reduction(
+        min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
+
+    size_t encoded_size = 0;
+    for ([[maybe_unused]] auto _: state) {
+        const compressed_database_t compressed{db};
+        encoded_size = compressed.encoded_size();
+        benchmark::DoNotOptimize(encoded_size);
+    }
+
+    state.counters["csr_bytes"] = static_cast<double>(get_csr_size(db));
+    state.counters["compressed_bytes"] = static_cast<double>(encoded_size);
+    state.counters["ratio"] = static_cast<double>(encoded_size) / static_cast<double>(get_csr_size(db));
+}
+
+template<typename Algorithm>
+static void run_algorithm(benchmark::State &state, const std::string_view &filename, const Algorithm &algorithm) {
+    const auto database = data::read_csv(filename).value();
+    const auto min_support = get_min_support_per_mille(state, database.size());
+
+    size_t num_itemsets = 0;
+    const itemset_sink_t sink = [&](const transaction_t &, size_t) { ++num_itemsets; };
+
+    for ([[maybe_unused]] auto _: state) {
+        state.PauseTiming();
+        auto db = database;
+        state.ResumeTiming();
+
+        algorithm(std::move(db), min_support, sink);
+    }
+    benchmark::DoNotOptimize(num_itemsets);
+}
+
+static void fp_growth_raw_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, [](database_t &&db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::fp_growth::fp_growth_algorithm(db, min_support, sink);
+    });
+}
+
+static void fp_growth_compressed_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, [](database_t &&db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::fp_growth::fp_growth_compressed(std::move(db), min_support, sink);
+    });
+}
+
+static void relim_raw_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, [](database_t &&db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::relim::relim_algorithm(db, min_support, sink);
+    });
+}
+
+static void relim_compressed_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, [](database_t &&db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::relim::relim_compressed(std::move(db), min_support, sink);
+    });
+}
+
+// the sizes are reported as counters, the minimum supports are given in per mille
+BENCHMARK_CAPTURE(compress_benchmark, "mushroom", "data/mushroom.dat")
+        ->Arg(100)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(compress_benchmark, "chess", "data/chess.dat")
+        ->Arg(800)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(compress_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_raw_benchmark, "retail", "data/retail.dat")
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_compressed_benchmark, "retail", "data/retail.dat")
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(relim_raw_benchmark, "retail", "data/retail.dat")
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(relim_compressed_benchmark, "retail", "data/retail.dat")
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef NDEBUG
+BENCHMARK_CAPTURE(fp_growth_raw_benchmark, "chess", "data/chess.dat")
+        ->Arg(800)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_compressed_benchmark, "chess", "data/chess.dat")
+        ->Arg(800)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(relim_raw_benchmark, "chess", "data/chess.dat")
+        ->Arg(800)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(relim_compressed_benchmark, "chess", "data/chess.dat")
+        ->Arg(800)
+        ->Unit(benchmark::kMillisecond);
+#endif
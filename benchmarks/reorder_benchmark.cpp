@@ -0,0 +1,125 @@
+/// @file reorder_benchmark.cpp
+/// @brief Benchmarks of Eclat and FP-Growth on databases in lexicographical and in Gray code order.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include "benchmark/benchmark.h"
+#include "reader.h"
+#include "eclat.h"
+#include "fp_growth.h"
+#include "utils.h"
+
+using namespace std;
+using namespace fim;
+
+/// Helper function: Creates the ranked database, optionally reordered by the Gray code of its patterns.
+static auto create_ranked_database(const database_t &db, const size_t min_support, const bool gray_code)
+    -> ranked_database_t {
+    auto ranked_db = db.rank_reduction(
+        min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
+
+    if (gray_code) {
+        std::get<0>(ranked_db).gray_code_sort();
+    }
+    return ranked_db;
+}
+
+template<typename Algorithm>
+static void run_algorithm(
+    benchmark::State &state,
+    const std::string_view &filename,
+    const bool gray_code,
+    const Algorithm &algorithm) {
+    const auto database = data::read_csv(filename).value();
+    const size_t min_support = get_min_support(state, database.size());
+    const auto [db, item_counts, item_ranks] = create_ranked_database(database, min_support, gray_code);
+
+    size_t num_itemsets = 0;
+    const itemset_sink_t sink = [&](const transaction_t &, size_t) { ++num_itemsets; };
+
+    for ([[maybe_unused]] auto _: state) {
+        algorithm({db, item_counts}, min_support, sink);
+    }
+    benchmark::DoNotOptimize(num_itemsets);
+}
+
+static void eclat_lexicographical_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, false, [](const database_view_t &db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::eclat::eclat_algorithm_(db, min_support, sink);
+    });
+}
+
+static void eclat_gray_code_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, true, [](const database_view_t &db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::eclat::eclat_algorithm_(db, min_support, sink);
+    });
+}
+
+static void fp_growth_lexicographical_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, false, [](const database_view_t &db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::fp_growth::fp_growth_algorithm_(db, min_support, sink);
+    });
+}
+
+static void fp_growth_gray_code_benchmark(benchmark::State &state, const std::string_view &filename) {
+    run_algorithm(state, filename, true, [](const database_view_t &db, const size_t min_support, const itemset_sink_t &sink) {
+        algorithm::fp_growth::fp_growth_algorithm_(db, min_support, sink);
+    });
+}
+
+BENCHMARK_CAPTURE(eclat_lexicographical_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(eclat_gray_code_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_lexicographical_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_gray_code_benchmark, "retail", "data/retail.dat")
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef NDEBUG
+BENCHMARK_CAPTURE(eclat_lexicographical_benchmark, "chess", "data/chess.dat")
+        ->Arg(80)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(eclat_gray_code_benchmark, "chess", "data/chess.dat")
+        ->Arg(80)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_lexicographical_benchmark, "chess", "data/chess.dat")
+        ->Arg(80)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(fp_growth_gray_code_benchmark, "chess", "data/chess.dat")
+        ->Arg(80)
+        ->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,131 @@
+/// @file simd_benchmark.cpp
+/// @brief Benchmark test for the vectorized itemset kernels.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "itemset.h"
+#include "simd.h"
+
+using namespace std;
+using namespace fim;
+
+/// Helper function: Creates pairs of random itemsets, where the first one has about `size` items out of a universe
+/// of `4 * size` items. The second one has `subset_size` items and is a subset of the first one in half of the pairs.
+static auto create_pairs(const size_t size, const size_t subset_size)
+    -> vector<pair<vector<item_t>, vector<item_t> > > {
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<item_t> distribution{0, static_cast<item_t>(4 * size)};
+
+    vector<pair<vector<item_t>, vector<item_t> > > pairs(1024);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        auto &[x, y] = pairs[i];
+        x.resize(size);
+        std::ranges::generate(x, [&] { return distribution(gen); });
+        std::ranges::sort(x);
+        x.erase(std::ranges::unique(x).begin(), x.end());
+
+        if (i % 2 == 0) {
+            std::ranges::sample(x, std::back_inserter(y), subset_size, gen);
+        } else {
+            y.resize(subset_size);
+            std::ranges::generate(y, [&] { return distribution(gen); });
+            std::ranges::sort(y);
+            y.erase(std::ranges::unique(y).begin(), y.end());
+        }
+    }
+    return pairs;
+}
+
+template<typename Kernel>
+static void run_kernel(benchmark::State &state, const Kernel &kernel) {
+    const auto pairs = create_pairs(state.range(0), state.range(1));
+    for ([[maybe_unused]] auto _: state) {
+        for (const auto &[x, y]: pairs) {
+            benchmark::DoNotOptimize(kernel(x, y));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pairs.size()));
+}
+
+static void scalar_includes_benchmark(benchmark::State &state) {
+    run_kernel(state, [](const auto &x, const auto &y) { return std::ranges::includes(x, y); });
+}
+
+static void simd_includes_benchmark(benchmark::State &state) {
+    run_kernel(state, [](const auto &x, const auto &y) { return simd::includes<item_t>(x, y); });
+}
+
+/// Helper function: Compares every array with an equal copy, which is the worst case of a lexicographical compare.
+template<typename Compare>
+static void run_lexicographical_compare(benchmark::State &state, const Compare &comp) {
+    const auto pairs = create_pairs(state.range(0), 0);
+    const auto copies = pairs;
+    for ([[maybe_unused]] auto _: state) {
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            benchmark::DoNotOptimize(
+                lexicographical_compare(transaction_t{pairs[i].first}, transaction_t{copies[i].first}, comp));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pairs.size()));
+}
+
+static void scalar_lexicographical_compare_benchmark(benchmark::State &state) {
+    run_lexicographical_compare(state, item_compare_t{default_item_compare});
+}
+
+static void simd_lexicographical_compare_benchmark(benchmark::State &state) {
+    run_lexicographical_compare(state, rank_compare_t{});
+}
+
+static void scalar_set_difference_benchmark(benchmark::State &state) {
+    run_kernel(state, [](const auto &x, const auto &y) {
+        itemset_t z{};
+        z.reserve(x.size());
+        std::ranges::set_difference(x, y, std::back_inserter(z));
+        return z.size();
+    });
+}
+
+static void simd_set_difference_benchmark(benchmark::State &state) {
+    run_kernel(state, [](const auto &x, const auto &y) {
+        itemset_t z{};
+        z.reserve(x.size());
+        simd::set_difference<item_t>(x, y, std::back_inserter(z));
+        return z.size();
+    });
+}
+
+BENCHMARK(scalar_includes_benchmark)->ArgsProduct({{8, 32, 128}, {3, 8}});
+BENCHMARK(simd_includes_benchmark)->ArgsProduct({{8, 32, 128}, {3, 8}});
+BENCHMARK(scalar_lexicographical_compare_benchmark)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(simd_lexicographical_compare_benchmark)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(scalar_set_difference_benchmark)->ArgsProduct({{8, 32, 128}, {3, 8}});
+BENCHMARK(simd_set_difference_benchmark)->ArgsProduct({{8, 32, 128}, {3, 8}});
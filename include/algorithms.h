@@ -28,6 +28,9 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
+#include <memory_resource>
 #include "itemset.h"
 #include "apriori.h"
 #include "fp_growth.h"
@@ -37,7 +40,21 @@
 namespace fim::algorithm {
     /// Define a type alias for a function that takes a database and a minimum support value as inputs,
     /// and perform a frequent itemset mining algorithm.
-    using algorithm_function_t = std::function<itemsets_t(const database_counts_t &database, size_t min_support)>;
+    using algorithm_function_t = std::function<itemsets_t(const database_view_t &database, size_t min_support)>;
+
+    /// Define a type alias for a function that takes a database, a minimum support value, a sink and a memory
+    /// resource as inputs, and passes each frequent itemset to the sink as soon as the algorithm finds it.
+    using sink_algorithm_function_t = std::function<void(
+        const database_view_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource)>;
+
+    /// Define a type alias for a function that takes a database and a minimum support value as inputs,
+    /// and returns the frequent itemsets together with their support counts, in the same order.
+    using counting_algorithm_function_t = std::function<std::tuple<itemsets_t, counts_t>(
+        const database_view_t &database,
+        size_t min_support)>;
 
     /// Enum of frequent itemset mining algorithms.
     enum class algorithm_t : int {
@@ -47,12 +64,30 @@ namespace fim::algorithm {
         ECLAT
     };
 
+    // Function pointer types selecting the overloads of the algorithms.
+    using algorithm_pointer_t = itemsets_t (*)(const database_view_t &, size_t);
+    using sink_algorithm_pointer_t = void (*)(
+        const database_view_t &, size_t, const itemset_sink_t &, std::pmr::memory_resource *);
+
     // Map from an enum to function pointers representing frequent itemset mining algorithms.
     const auto map_algorithm_function = std::map<algorithm_t, algorithm_function_t>{
-        {algorithm_t::APRIORI, apriori::apriori_algorithm_},
-        {algorithm_t::FP_GROWTH, fp_growth::fp_growth_algorithm_},
-        {algorithm_t::RELIM, relim::relim_algorithm_},
-        {algorithm_t::ECLAT, eclat::eclat_algorithm_}
+        {algorithm_t::APRIORI, static_cast<algorithm_pointer_t>(apriori::apriori_algorithm_)},
+        {algorithm_t::FP_GROWTH, static_cast<algorithm_pointer_t>(fp_growth::fp_growth_algorithm_)},
+        {algorithm_t::RELIM, static_cast<algorithm_pointer_t>(relim::relim_algorithm_)},
+        {algorithm_t::ECLAT, static_cast<algorithm_pointer_t>(eclat::eclat_algorithm_)}
+    };
+
+    // Map from an enum to function pointers representing the streaming versions of the algorithms.
+    const auto map_sink_algorithm_function = std::map<algorithm_t, sink_algorithm_function_t>{
+        // Apriori keeps its candidates in flat collections per level and doesn't allocate from the resource
+        {
+            algorithm_t::APRIORI,
+            [](const database_view_t &database, const size_t min_support, const itemset_sink_t &sink,
+               std::pmr::memory_resource *) { apriori::apriori_algorithm_(database, min_support, sink); }
+        },
+        {algorithm_t::FP_GROWTH, static_cast<sink_algorithm_pointer_t>(fp_growth::fp_growth_algorithm_)},
+        {algorithm_t::RELIM, static_cast<sink_algorithm_pointer_t>(relim::relim_algorithm_)},
+        {algorithm_t::ECLAT, static_cast<sink_algorithm_pointer_t>(eclat::eclat_algorithm_)}
     };
 
     /// @brief Retrieves the algorithm function associated with the specified enum type.
@@ -61,4 +96,34 @@ namespace fim::algorithm {
     inline algorithm_function_t get_algorithm(const algorithm_t algorithm) {
         return map_algorithm_function.at(algorithm);
     }
+
+    /// @brief Retrieves the streaming algorithm function associated with the specified enum type.
+    /// @param algorithm The specified enum algorithm type.
+    /// @return A function pointer to the algorithm that passes the frequent itemsets to a sink.
+    inline sink_algorithm_function_t get_sink_algorithm(const algorithm_t algorithm) {
+        return map_sink_algorithm_function.at(algorithm);
+    }
+
+    /// @brief Retrieves the algorithm function associated with the specified enum type, which also returns the
+    /// support counts the algorithm determined while mining, so that the database need not be scanned again.
+    /// @param algorithm The specified enum algorithm type.
+    /// @param resource The memory resource of the algorithm's data structures (optional).
+    /// @return A function returning the frequent itemsets and their support counts.
+    inline counting_algorithm_function_t get_counting_algorithm(
+        const algorithm_t algorithm,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+        return [algorithm = get_sink_algorithm(algorithm), resource](
+            const database_view_t &database,
+            const size_t min_support) {
+            itemsets_t itemsets{};
+            counts_t counts{};
+            const auto collect = [&](const transaction_t &itemset, const size_t support) {
+                itemsets.emplace_back(itemset.to_itemset());
+                counts.push_back(support);
+            };
+            algorithm(database, min_support, collect, resource);
+
+            return std::tuple{std::move(itemsets), std::move(counts)};
+        };
+    }
 }
@@ -40,6 +40,45 @@ namespace fim::algorithm::apriori {
     /// @return A collection of frequent one-itemsets that meet or exceed the minimum support.
     auto all_frequent_one_itemsets(const item_counts_t &item_counts, size_t min_support) -> itemsets_t;
 
+    // A prefix tree of candidates of the same size, which counts the supports of all candidates in one pass over
+    // the transactions (Bodon's trie): Each transaction is merged with the children of the root and, for each
+    // match, with the children of the matched node behind the matched item. The nodes of each depth are stored in
+    // the lexicographical order of their paths, so the children of a node are a contiguous range of the next depth.
+    struct candidate_trie_t {
+        std::vector<std::vector<item_t> > items{}; ///< The item of each node, per depth.
+        std::vector<std::vector<size_t> > children{}; ///< The first child of each node and the end, per inner depth.
+        std::vector<size_t> leaves{}; ///< The leaf of each candidate.
+
+        /// @brief Constructs the trie of candidates.
+        /// @param candidates The candidates, all of the same size and each sorted by the comparison.
+        /// @param compare The comparison of the items.
+        template<typename Compare>
+        candidate_trie_t(const itemsets_t &candidates, const Compare &compare);
+
+        /// @brief Gets the number of items of each candidate.
+        /// @return The depth of the trie.
+        [[nodiscard]] auto depth() const -> size_t { return items.size(); }
+
+        /// @brief Counts the supports of the candidates in a database.
+        /// @param database The database, whose transactions are sorted by the comparison.
+        /// @param compare The comparison of the items.
+        /// @return The support of each candidate, in the order of the candidates.
+        template<typename Compare>
+        [[nodiscard]] auto get_supports(const database_t &database, const Compare &compare) const -> counts_t;
+
+        /// @brief Counts the supports of the candidates in a database and trims its transactions for the next
+        /// level: A candidate with one more item needs `depth()` of the candidates of a transaction for each of
+        /// its items, so only the items matched that often are kept and only transactions with more than `depth()`
+        /// of them.
+        /// @param database The database, whose transactions are sorted by the comparison.
+        /// @param compare The comparison of the items.
+        /// @param trimmed The database, which is replaced by the trimmed transactions.
+        /// @return The support of each candidate, in the order of the candidates.
+        template<typename Compare>
+        auto get_supports(const database_t &database, const Compare &compare, database_t &trimmed) const
+            -> counts_t;
+    };
+
     /// @brief Generates candidate frequent itemsets of size k from frequent itemsets of size k-1.
     /// @param frequent_itemsets A collection of frequent itemsets of size k-1.
     /// @param k The size of the itemsets to generate (the size of the new candidate itemsets).
@@ -50,7 +89,18 @@ namespace fim::algorithm::apriori {
         size_t k,
         const item_compare_t &compare) -> itemsets_t;
 
+    /// @brief Generates candidate frequent itemsets of size k from frequent itemsets of ranked items of size k-1.
+    /// @param frequent_itemsets A collection of frequent itemsets of size k-1.
+    /// @param k The size of the itemsets to generate (the size of the new candidate itemsets).
+    /// @param compare The comparison of the ranks.
+    /// @return A collection of candidate frequent itemsets of size k.
+    auto generate_candidates(
+        const itemsets_t &frequent_itemsets,
+        size_t k,
+        const rank_compare_t &compare) -> itemsets_t;
+
     /// @brief Prunes the candidate itemsets by removing those that do not meet the minimum support threshold.
+    /// The supports are counted in one pass over the database with a candidate trie.
     /// @param candidates A collection of candidate itemsets to be pruned.
     /// @param database The database used to count the support of itemsets.
     /// @param min_support The minimum support value used to filter itemsets.
@@ -62,7 +112,22 @@ namespace fim::algorithm::apriori {
         size_t min_support,
         const item_compare_t &compare) -> void;
 
+    /// @brief Prunes the candidate itemsets of ranked items that do not meet the minimum support threshold.
+    /// The supports are counted with a candidate trie, or with bitsets if the database is dense.
+    /// @param candidates A collection of candidate itemsets to be pruned.
+    /// @param database The database of ranked items used to count the support of itemsets.
+    /// @param min_support The minimum support value used to filter itemsets.
+    /// @param compare The comparison of the ranks.
+    /// @return This function modifies the candidates in place.
+    auto prune(
+        itemsets_t &candidates,
+        const database_t &database,
+        size_t min_support,
+        const rank_compare_t &compare) -> void;
+
     /// @brief Implements the Apriori algorithm to find frequent itemsets in the given database.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
     /// @param database The database used to find frequent itemsets.
     /// @param min_support The minimum support threshold for considering an itemset as frequent.
     /// @return A collection of frequent itemsets that meet or exceed the minimum support.
@@ -70,8 +135,22 @@ namespace fim::algorithm::apriori {
 
     /// @brief Implements the Apriori algorithm to find frequent itemsets in the given database.
     /// This version of the function takes a reduced database and item counts as input.
-    /// @param database A tuple containing the reduced database and item's frequencies.
+    /// @param database A view of the reduced database and item's frequencies.
     /// @param min_support The minimum support threshold for considering an itemset as frequent.
     /// @return A collection of frequent itemsets that meet or exceed the minimum support.
-    auto apriori_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t;
+    auto apriori_algorithm_(const database_view_t &database, size_t min_support) -> itemsets_t;
+
+    /// @brief Implements the Apriori algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
+    /// @param database The database used to find frequent itemsets.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support.
+    auto apriori_algorithm(const database_t &database, size_t min_support, const itemset_sink_t &sink) -> void;
+
+    /// @brief Implements the Apriori algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support.
+    auto apriori_algorithm_(const database_view_t &database, size_t min_support, const itemset_sink_t &sink) -> void;
 }
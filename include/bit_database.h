@@ -0,0 +1,103 @@
+/// @file bit_database.h
+/// @brief A bit matrix representation of databases with a small item universe.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <variant>
+#include <vector>
+#include "itemset.h"
+#include "database.h"
+
+namespace fim {
+    // A set of ranks as a bitset with a fixed number of 64-bit words.
+    template<size_t NumWords>
+    using bitset_t = std::array<std::uint64_t, NumWords>;
+
+    /// @brief Checks if the bits of one bitset are a subset of the bits of another.
+    /// @param x The first bitset.
+    /// @param y The second bitset.
+    /// @return True if every bit set in `x` is set in `y`, false otherwise.
+    template<size_t NumWords>
+    constexpr auto is_subset(const bitset_t<NumWords> &x, const bitset_t<NumWords> &y) -> bool {
+        std::uint64_t missing = 0;
+        for (size_t word = 0; word < NumWords; ++word) {
+            missing |= x[word] & ~y[word];
+        }
+        return missing == 0;
+    }
+
+    // A database of ranked items, where each transaction is stored as a bitset of fixed width. Subset tests and
+    // support counting are a few bitwise operations per transaction instead of merging the items.
+    template<size_t NumWords>
+    struct bit_database_t {
+        static constexpr size_t max_items = 64 * NumWords; ///< The number of ranks that fit into a bitset.
+
+        std::vector<bitset_t<NumWords> > rows{}; ///< The bitset of each transaction.
+        std::vector<size_t> weights{}; ///< The multiplicity of each transaction; empty if all weights are one.
+
+        bit_database_t() = default;
+
+        /// @brief Constructs the bit matrix of a database whose ranks are less than `max_items`.
+        /// @param database The database of ranked items.
+        explicit bit_database_t(const database_t &database);
+
+        /// @brief Gets the number of transactions.
+        /// @return The number of transactions.
+        [[nodiscard]] auto size() const -> size_t { return rows.size(); }
+
+        /// @brief Converts an itemset of ranks less than `max_items` into a bitset.
+        /// @param itemset The itemset of ranks.
+        /// @return The bitset with the bits of the ranks set.
+        static auto to_bitset(const transaction_t &itemset) -> bitset_t<NumWords>;
+
+        /// @brief Gets the support of an itemset, i.e. the weighted number of transactions containing it.
+        /// @param itemset The itemset of ranks.
+        /// @return The support of the itemset.
+        [[nodiscard]] auto get_support(const transaction_t &itemset) const -> size_t;
+
+        /// @brief Gets the supports of several itemsets.
+        /// @param itemsets The itemsets of ranks.
+        /// @return The support of each itemset.
+        [[nodiscard]] auto get_supports(const itemsets_t &itemsets) const -> counts_t;
+    };
+
+    extern template struct bit_database_t<1>;
+    extern template struct bit_database_t<2>;
+    extern template struct bit_database_t<4>;
+
+    // The bit matrix of a database with the smallest width (64, 128 or 256 bits) that fits all its ranks,
+    // or std::monostate if there are more ranks.
+    using bit_matrix_t = std::variant<std::monostate, bit_database_t<1>, bit_database_t<2>, bit_database_t<4> >;
+
+    /// @brief Creates the bit matrix of a database of ranked items.
+    /// @param database The database of ranked items.
+    /// @return The bit matrix of the smallest width that fits all ranks, std::monostate if no width does.
+    auto create_bit_matrix(const database_t &database) -> bit_matrix_t;
+}
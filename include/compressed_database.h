@@ -0,0 +1,123 @@
+/// @file compressed_database.h
+/// @brief A prefix-compressed representation of sorted databases.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include "itemset.h"
+#include "database.h"
+
+namespace fim {
+    // A database stored as a byte stream, in which each transaction only stores the items behind the prefix it
+    // shares with the previous transaction. After sorting the database lexicographically, neighbouring
+    // transactions share long prefixes. Each transaction is encoded as varints: the length of the shared prefix,
+    // the number of remaining items, the weight (if the database is weighted) and the remaining items as
+    // zigzag-encoded differences to their predecessor (so ascending ranks take a byte each). The transactions
+    // can only be decoded one after another.
+    struct compressed_database_t {
+        // Decodes the transactions one after another. The current transaction is kept in a buffer, of which only
+        // the items behind the shared prefix are overwritten by the next transaction.
+        struct decoder_t {
+            const compressed_database_t *database{nullptr};
+            size_t position{0}; ///< The position of the next transaction in the byte stream.
+            size_t prefix_size{0}; ///< The number of items the current transaction shares with the previous one.
+            size_t weight{1}; ///< The weight of the current transaction.
+            std::vector<item_t> items{}; ///< The items of the current transaction.
+
+            /// @brief Decodes the next transaction.
+            /// @return True if a transaction has been decoded, false if all transactions have been decoded.
+            auto next() -> bool;
+
+            /// @brief Gets the current transaction.
+            /// @return A view of the items of the current transaction, valid until the next call of `next`.
+            [[nodiscard]] auto transaction() const -> transaction_t { return {items.data(), items.size()}; }
+        };
+
+        std::vector<std::uint8_t> bytes{}; ///< The encoded transactions.
+        size_t num_transactions{0}; ///< The number of transactions.
+        size_t num_items{0}; ///< The number of items of all transactions.
+        bool weighted{false}; ///< Whether the weights of the transactions are encoded.
+
+        compressed_database_t() = default;
+
+        /// @brief Compresses a database. The compression is most effective if the database is sorted
+        /// lexicographically, but any database is compressed without loss.
+        /// @param database The database to compress.
+        explicit compressed_database_t(const database_t &database);
+
+        /// @brief Gets the number of transactions.
+        /// @return The number of transactions.
+        [[nodiscard]] auto size() const -> size_t { return num_transactions; }
+
+        /// @brief Checks if the database contains no transactions.
+        /// @return True if the database is empty, false otherwise.
+        [[nodiscard]] auto empty() const -> bool { return num_transactions == 0; }
+
+        /// @brief Checks if the transactions carry weights other than one.
+        /// @return True if the database is weighted, false otherwise.
+        [[nodiscard]] auto is_weighted() const -> bool { return weighted; }
+
+        /// @brief Gets the number of bytes of the encoded transactions.
+        /// @return The size of the byte stream.
+        [[nodiscard]] auto encoded_size() const -> size_t { return bytes.size(); }
+
+        /// @brief Creates a decoder positioned before the first transaction.
+        /// @return The decoder.
+        [[nodiscard]] auto decoder() const -> decoder_t { return decoder_t{.database = this}; }
+
+        /// @brief Decompresses the database.
+        /// @return The database of the same transactions in the same order.
+        [[nodiscard]] auto to_database() const -> database_t;
+    };
+
+    /// A view of a compressed reduced database and the item's frequencies.
+    using compressed_database_view_t = std::tuple<const compressed_database_t &, const item_counts_t &>;
+
+    /// @brief Calls a function with each transaction of a database and its weight.
+    /// @param database The database.
+    /// @param visit The function called with a view of each transaction and its weight.
+    template<typename Visit>
+    auto for_each_transaction(const database_t &database, const Visit &visit) -> void {
+        for (size_t i = 0; i < database.size(); ++i) {
+            visit(database[i], database.get_weight(i));
+        }
+    }
+
+    /// @brief Calls a function with each transaction of a compressed database and its weight.
+    /// @param database The compressed database.
+    /// @param visit The function called with a view of each transaction and its weight.
+    template<typename Visit>
+    auto for_each_transaction(const compressed_database_t &database, const Visit &visit) -> void {
+        for (auto decoder = database.decoder(); decoder.next();) {
+            visit(decoder.transaction(), decoder.weight);
+        }
+    }
+}
@@ -28,37 +28,239 @@
 
 #pragma once
 
+#include <iterator>
+#include <tuple>
+#include <vector>
 #include "itemset.h"
 #include "item_counts.h"
 
 namespace fim {
     using database_counts_t = std::tuple<database_t, item_counts_t>;
+    using ranked_database_t = std::tuple<database_t, item_counts_t, item_ranks_t>;
 
-    // The transaction database type.
-    struct database_t : std::vector<itemset_t> {
-        using std::vector<itemset_t>::vector;
+    // Non-owning view of a reduced database and the item's frequencies (the input of the algorithms).
+    using database_view_t = std::tuple<const database_t &, const item_counts_t &>;
+
+    // A database reduced in place (or into a buffer) together with the item's frequencies.
+    using reduced_database_t = std::tuple<const database_t &, item_counts_t>;
+
+    /// Algorithms for sorting the transactions of a database.
+    enum class sort_algorithm_t : int {
+        COMPARISON, ///< Comparison sort of the items and transactions.
+        RADIX ///< Multithreaded MSD radix sort with the frequency ranks of the items as keys.
+    };
+
+    /// Configuration for the reduction of the database
+    struct reduce_config_t {
+        bool collapse_duplicates = false; ///< Collapses identical transactions into one weighted transaction.
+        sort_algorithm_t sort_algorithm = sort_algorithm_t::COMPARISON; ///< The algorithm sorting the database.
+        size_t num_threads = 0; ///< The number of threads (0 uses the hardware concurrency).
+    };
+
+    // The transaction database type: The items of all transactions are stored in one contiguous array
+    // (compressed sparse row layout) and each transaction is a view given by its offsets into this array.
+    // A weighted database stores identical transactions once together with their multiplicity.
+    struct database_t {
+        // Random access iterator over the transactions of the database.
+        struct iterator {
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = transaction_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = transaction_t;
+            using pointer = void;
+
+            const database_t *database{nullptr};
+            size_t index{0};
+
+            auto operator*() const -> transaction_t { return (*database)[index]; }
+            auto operator[](const difference_type n) const -> transaction_t { return (*database)[index + n]; }
+
+            auto operator++() -> iterator & { ++index; return *this; }
+            auto operator--() -> iterator & { --index; return *this; }
+            auto operator++(int) -> iterator { auto it = *this; ++index; return it; }
+            auto operator--(int) -> iterator { auto it = *this; --index; return it; }
+            auto operator+=(const difference_type n) -> iterator & { index += n; return *this; }
+            auto operator-=(const difference_type n) -> iterator & { index -= n; return *this; }
+
+            friend auto operator+(iterator it, const difference_type n) -> iterator { return it += n; }
+            friend auto operator+(const difference_type n, iterator it) -> iterator { return it += n; }
+            friend auto operator-(iterator it, const difference_type n) -> iterator { return it -= n; }
+
+            friend auto operator-(const iterator &x, const iterator &y) -> difference_type {
+                return static_cast<difference_type>(x.index) - static_cast<difference_type>(y.index);
+            }
+
+            friend auto operator==(const iterator &x, const iterator &y) -> bool { return x.index == y.index; }
+            friend auto operator<=>(const iterator &x, const iterator &y) { return x.index <=> y.index; }
+        };
+
+        using value_type = transaction_t;
+        using size_type = size_t;
+        using const_iterator = iterator;
+
+        std::vector<item_t> items{}; ///< The items of all transactions, stored one transaction after another.
+        std::vector<size_t> offsets{0}; ///< The start of each transaction in `items`, followed by the end of the last.
+        std::vector<size_t> weights{}; ///< The multiplicity of each transaction; empty if all weights are one.
+
+        database_t() = default;
+
+        /// @brief Constructor that initializes the database with a list of itemsets.
+        /// @param itemsets The itemsets used as transactions.
+        database_t(std::initializer_list<itemset_t> itemsets);
 
         /// @brief Constructor that initializes the database with a collection of itemsets.
         /// @param itemsets A collection of itemsets to initialize the database.
-        explicit database_t(itemsets_t itemsets);
+        explicit database_t(const itemsets_t &itemsets);
+
+        /// @brief Gets the number of transactions.
+        /// @return The number of transactions.
+        [[nodiscard]] auto size() const -> size_t { return offsets.size() - 1; }
+
+        /// @brief Checks if the database contains no transactions.
+        /// @return True if the database is empty, false otherwise.
+        [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+
+        /// @brief Gets the transaction at the given position.
+        /// @param pos The position of the transaction.
+        /// @return A view of the items of the transaction.
+        [[nodiscard]] auto operator[](const size_t pos) const -> transaction_t {
+            return {items.data() + offsets[pos], items.data() + offsets[pos + 1]};
+        }
+
+        [[nodiscard]] auto begin() const -> iterator { return {this, 0}; }
+        [[nodiscard]] auto end() const -> iterator { return {this, size()}; }
+        [[nodiscard]] auto front() const -> transaction_t { return (*this)[0]; }
+        [[nodiscard]] auto back() const -> transaction_t { return (*this)[size() - 1]; }
+
+        /// @brief Gets the weight (multiplicity) of the transaction at the given position.
+        /// @param pos The position of the transaction.
+        /// @return The number of occurrences of the transaction.
+        [[nodiscard]] auto get_weight(const size_t pos) const -> size_t {
+            return weights.empty() ? 1 : weights[pos];
+        }
+
+        /// @brief Checks if the transactions carry weights other than one.
+        /// @return True if the database is weighted, false otherwise.
+        [[nodiscard]] auto is_weighted() const -> bool { return not weights.empty(); }
+
+        /// @brief Gets the number of transactions including their multiplicities.
+        /// @return The sum of the weights of all transactions.
+        [[nodiscard]] auto get_total_weight() const -> size_t;
+
+        /// @brief Reserves memory for the given number of transactions and items.
+        /// @param num_transactions The number of transactions.
+        /// @param num_items The total number of items of all transactions.
+        auto reserve(size_t num_transactions, size_t num_items = 0) -> void;
+
+        /// @brief Removes all transactions.
+        auto clear() -> void;
+
+        /// @brief Appends a transaction to the database.
+        /// @param transaction The items of the transaction.
+        /// @param weight The multiplicity of the transaction.
+        auto push_back(const transaction_t &transaction, size_t weight = 1) -> void;
+
+        /// @brief Collapses adjacent identical transactions into one transaction whose weight is the sum of
+        /// their weights. Applied to a sorted database, all duplicates are removed.
+        auto collapse_duplicates() -> void;
+
+        /// @brief Checks if two databases contain the same transactions in the same order.
+        friend auto operator==(const database_t &x, const database_t &y) -> bool = default;
 
         /// @brief Sorts the database lexicographically using the provided comparison function.
         /// @param compare A comparison function used to sort the itemsets lexicographically.
-        /// @return A new sorted database.
-        auto sort_lexicographically(const item_compare_t &compare) -> database_t;
+        /// @return A reference to the sorted database.
+        auto sort_lexicographically(const item_compare_t &compare) -> database_t &;
+
+        /// @brief Sorts the database of ranked items lexicographically.
+        /// @param compare The comparison of the ranks.
+        /// @return A reference to the sorted database.
+        auto sort_lexicographically(const rank_compare_t &compare) -> database_t &;
+
+        /// @brief Sorts the database of ranked items lexicographically with a multithreaded MSD radix sort.
+        /// The ranks are used as keys of the buckets, both for sorting the items of each transaction and for
+        /// sorting the transactions. Items that are not dense ranks are sorted by comparison instead.
+        /// @param num_threads The number of threads (0 uses the hardware concurrency).
+        /// @return A reference to the sorted database.
+        auto radix_sort_lexicographically(size_t num_threads = 0) -> database_t &;
+
+        /// @brief Reorders the transactions of a database of ranked items, so that similar transactions are
+        /// neighbours: Each transaction is keyed by the bit pattern of its ranks among the given number of highest
+        /// ranks (the ranks ascend by support, so these are the most frequent items), the highest rank as the
+        /// highest bit, and the transactions are sorted by the positions of their patterns in the reflected Gray
+        /// code. Neighbouring patterns then differ in few of the most frequent items, which shortens the runs of
+        /// transaction ids and the distance between similar paths of an FP-tree. Transactions of the same pattern
+        /// keep their order, and the items of each transaction are not changed.
+        /// Relim expects the lexicographical order, Eclat and FP-Growth accept any order.
+        /// @param num_ranks The number of highest ranks forming the pattern (at most 64).
+        /// @return A reference to the reordered database.
+        auto gray_code_sort(size_t num_ranks = 64) -> database_t &;
 
         /// @brief Gets the frequencies of all items in the database.
+        /// Items from a dense universe (e.g. ranks or small identifiers) are counted in flat arrays by several
+        /// threads, others in a hash map.
+        /// @param num_threads The number of threads (0 uses the hardware concurrency).
         /// @return A collection of item frequencies.
-        [[nodiscard]] auto get_item_counts() const -> item_counts_t;
+        [[nodiscard]] auto get_item_counts(size_t num_threads = 0) const -> item_counts_t;
 
-        /// @brief Removes all infrequent items from the database and sorts all prefix sets.
+        /// @brief Removes all infrequent items from the database in place and sorts all prefix sets.
         /// @param min_support The minimum support threshold used to filter infrequent items.
-        /// @return A tuple containing the reduced database and item's frequencies.
-        auto reduce_database(size_t min_support) -> database_counts_t;
+        /// @param config The configuration of the reduction.
+        /// @return A tuple containing a reference to this (reduced) database and item's frequencies.
+        auto reduce_database(size_t min_support, const reduce_config_t &config = reduce_config_t{}) &
+            -> reduced_database_t;
+
+        /// @brief Removes all infrequent items from the database in place and sorts all prefix sets.
+        /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @param config The configuration of the reduction.
+        /// @return A tuple containing the reduced database (moved from this one) and item's frequencies.
+        auto reduce_database(size_t min_support, const reduce_config_t &config = reduce_config_t{}) &&
+            -> database_counts_t;
 
         /// @brief Removes all infrequent items from the database and sorts all prefix sets (const version).
         /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @param config The configuration of the reduction.
         /// @return A tuple containing the reduced database and item's frequencies.
-        [[nodiscard]] auto transaction_reduction(size_t min_support) const -> database_counts_t;
+        [[nodiscard]] auto transaction_reduction(
+            size_t min_support,
+            const reduce_config_t &config = reduce_config_t{}) const & -> database_counts_t;
+
+        /// @brief Removes all infrequent items from the database and sorts all prefix sets (in place).
+        /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @param config The configuration of the reduction.
+        /// @return A tuple containing the reduced database (moved from this one) and item's frequencies.
+        [[nodiscard]] auto transaction_reduction(
+            size_t min_support,
+            const reduce_config_t &config = reduce_config_t{}) && -> database_counts_t;
+
+        /// @brief Writes the database without infrequent items into the given buffer and sorts all prefix sets.
+        /// The buffer's memory is reused, this database is not modified.
+        /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @param buffer The database receiving the reduced transactions.
+        /// @param config The configuration of the reduction.
+        /// @return A tuple containing a reference to the buffer and item's frequencies.
+        auto transaction_reduction(
+            size_t min_support,
+            database_t &buffer,
+            const reduce_config_t &config = reduce_config_t{}) const & -> reduced_database_t;
+
+        /// @brief Removes all infrequent items from the database and replaces the remaining items by their
+        /// dense ranks, so that the item order is a plain integer comparison. All transactions are sorted.
+        /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @param config The configuration of the reduction.
+        /// @return A tuple containing the ranked database, the rank's frequencies and the mapping from
+        /// ranks back to the original items.
+        [[nodiscard]] auto rank_reduction(
+            size_t min_support,
+            const reduce_config_t &config = reduce_config_t{}) const & -> ranked_database_t;
+
+        /// @brief Removes all infrequent items and replaces the remaining items by their dense ranks in place.
+        /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @param config The configuration of the reduction.
+        /// @return A tuple containing the ranked database (moved from this one), the rank's frequencies and
+        /// the mapping from ranks back to the original items.
+        [[nodiscard]] auto rank_reduction(
+            size_t min_support,
+            const reduce_config_t &config = reduce_config_t{}) && -> ranked_database_t;
     };
 }
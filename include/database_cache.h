@@ -0,0 +1,121 @@
+/// @file database_cache.h
+/// @brief A database that caches the preprocessed representations of the algorithms.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include "database.h"
+#include "algorithms.h"
+
+namespace fim {
+    // Owns a database and lazily builds and caches the representations the algorithms derive from it, keyed by
+    // the minimum support: the reduced and ranked database with the item's frequencies, the vertical database of
+    // Eclat and the FP-tree of FP-Growth. Mining the same data several times, e.g. with several algorithms, only
+    // preprocesses it once per minimum support. The database can only be changed through the cache, which drops
+    // all cached representations. The cache is not thread-safe.
+    class database_cache_t {
+    public:
+        /// The reduction of the cached databases, the same one the algorithms apply themselves.
+        static constexpr auto reduce_config = reduce_config_t{
+            .collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX
+        };
+
+        database_cache_t() = default;
+
+        /// @brief Constructor that takes over a database.
+        /// @param database The database.
+        explicit database_cache_t(database_t database) : database_(std::move(database)) {
+        }
+
+        /// @brief Gets the database.
+        /// @return The (unreduced) database.
+        [[nodiscard]] auto get_database() const -> const database_t & { return database_; }
+
+        /// @brief Adds a transaction to the database and drops all cached representations.
+        /// @param transaction The transaction.
+        /// @param weight The weight of the transaction (optional).
+        auto push_back(const transaction_t &transaction, size_t weight = 1) -> void;
+
+        /// @brief Changes the database by a function and drops all cached representations.
+        /// @param change The function that is called with the database.
+        template<typename Change>
+        auto update(const Change &change) -> void {
+            change(database_);
+            invalidate();
+        }
+
+        /// @brief Drops all cached representations.
+        auto invalidate() -> void { entries_.clear(); }
+
+        /// @brief Gets the number of minimum supports with cached representations.
+        /// @return The number of cached minimum supports.
+        [[nodiscard]] auto num_cached() const -> size_t { return entries_.size(); }
+
+        /// @brief Gets the database reduced to the items of a minimum support, see database_t::rank_reduction.
+        /// @param min_support The minimum support.
+        /// @return The ranked database, the rank's frequencies and the mapping from ranks back to the items.
+        auto get_ranked_database(size_t min_support) -> const ranked_database_t &;
+
+        /// @brief Gets the vertical database of the ranked database of a minimum support.
+        /// @param min_support The minimum support.
+        /// @return The vertical database, which maps each rank to the ids of the transactions containing it.
+        auto get_vertical_database(size_t min_support) -> const algorithm::eclat::vertical_database_t &;
+
+        /// @brief Gets the FP-tree of the ranked database of a minimum support.
+        /// @param min_support The minimum support.
+        /// @return The root of the FP-tree.
+        auto get_fp_tree(size_t min_support) -> const fp_tree::node_ptr &;
+
+        /// @brief Mines the frequent itemsets with an algorithm, starting from the cached representations.
+        /// @param algorithm The algorithm.
+        /// @param min_support The minimum support threshold for considering an itemset as frequent.
+        /// @param sink The sink receiving the frequent itemsets (of the original items) and their support.
+        /// @param resource The memory resource of the algorithm's data structures (optional).
+        auto mine(
+            algorithm::algorithm_t algorithm,
+            size_t min_support,
+            const itemset_sink_t &sink,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    private:
+        // The cached representations of the database for one minimum support.
+        struct entry_t {
+            ranked_database_t ranked_database{}; ///< The reduced database, item's frequencies and ranks.
+            std::optional<algorithm::eclat::vertical_database_t> vertical_database{}; ///< Built on first use.
+            fp_tree::node_ptr fp_tree{}; ///< Built on first use.
+        };
+
+        database_t database_{};
+        std::map<size_t, std::unique_ptr<entry_t> > entries_{};
+
+        auto get_entry(size_t min_support) -> entry_t &;
+    };
+}
@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <set>
+#include <unordered_map>
 #include "database.h"
 #include "itemset.h"
 
@@ -37,31 +39,86 @@ namespace fim::algorithm::eclat {
     using tid_t = size_t;
 
     // Transaction identification set, representing a collection of transaction ids.
-    using tidset_t = std::set<tid_t>;
+    using tidset_t = std::pmr::set<tid_t>;
 
     // The vertical transaction database type, mapping item identifiers to the set of ids containing that item.
-    using vertical_database_t = std::unordered_map<item_t, tidset_t>;
+    using vertical_database_t = std::pmr::unordered_map<item_t, tidset_t>;
 
     /// @brief Computes the intersection of two transaction-id sets.
     /// @param x The first transaction id set (suffix).
     /// @param y The second transaction id set (suffix).
+    /// @param resource The memory resource of the intersection (optional).
     /// @return The intersection of the two sets, containing only transaction ids that appear in both sets.
-    auto set_intersection(const tidset_t &x, const tidset_t &y) -> tidset_t;
+    auto set_intersection(
+        const tidset_t &x,
+        const tidset_t &y,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> tidset_t;
+
+    /// @brief Gets the support of a transaction id set, i.e. the sum of the weights of its transactions.
+    /// @param tidset The transaction id set.
+    /// @param database The transaction database the ids refer to.
+    /// @return The number of transactions (including their multiplicities) in the set.
+    auto get_support(const tidset_t &tidset, const database_t &database) -> size_t;
 
     /// @brief Converts the given transaction database to a vertical representation.
     /// @param database The transaction database, which is a collection of itemsets (transactions).
+    /// @param resource The memory resource of the vertical database and its tidsets (optional).
     /// @return A vertical database, which maps each item to the set of transaction ids that contain it.
-    auto to_vertical_database(const database_t &database) -> vertical_database_t;
+    auto to_vertical_database(
+        const database_t &database,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> vertical_database_t;
 
     /// @brief Implements the ECLAT algorithm to find frequent itemsets in the transaction database.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
     /// @param database The transaction database used to find frequent itemsets.
     /// @param min_support The minimum support threshold for considering an itemset as frequent.
     /// @return A collection of frequent itemsets that meet or exceed the minimum support.
     auto eclat_algorithm(const database_t &database, size_t min_support) -> itemsets_t;
 
     /// @brief Implements the ECLAT algorithm to find frequent itemsets in the transaction database.
-    /// @param database A tuple containing the reduced database and item's frequencies.
+    /// @param database A view of the reduced database and item's frequencies.
     /// @param min_support The minimum support threshold for considering an itemset as frequent.
     /// @return A collection of frequent itemsets that meet or exceed the minimum support.
-    auto eclat_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t;
+    auto eclat_algorithm_(const database_view_t &database, size_t min_support) -> itemsets_t;
+
+    /// @brief Implements the ECLAT algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
+    /// @param database The transaction database used to find frequent itemsets.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support.
+    /// @param resource The memory resource of the tidsets and vertical databases (optional).
+    auto eclat_algorithm(
+        const database_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the ECLAT algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support.
+    /// @param resource The memory resource of the tidsets and vertical databases (optional). The conditional
+    /// structures of each extension of a prefix are built in an arena on top of it, which is released at once as
+    /// soon as the extension has been mined.
+    auto eclat_algorithm_(
+        const database_view_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the ECLAT algorithm on a vertical database built beforehand (e.g. a cached one) and
+    /// passes each frequent itemset to a sink as soon as it is found.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param vertical_database The vertical representation of the reduced database (see to_vertical_database).
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support.
+    /// @param resource The memory resource of the tidsets and conditional vertical databases (optional).
+    auto eclat_algorithm_(
+        const database_view_t &database,
+        const vertical_database_t &vertical_database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
 }
@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include <memory_resource>
 #include "fp_tree.h"
+#include "itemset_trie.h"
 
 namespace fim::algorithm::fp_growth {
     using namespace fim;
@@ -38,18 +40,114 @@ namespace fim::algorithm::fp_growth {
     /// @param root The current node in the FP-Tree being processed, which represents a prefix.
     /// @param item The item for which the conditional transaction database is being generated.
     /// @param compare
-    /// @return A new database containing the conditional transactions that correspond to the given item and node.
+    /// @return A new database containing the conditional transactions that correspond to the given item and node,
+    /// each prefix path once weighted by the frequency of its node.
     auto conditional_transactions(const node_ptr &root, item_t item, const item_compare_t &compare) -> database_t;
 
+    /// @brief Generates the conditional transaction database from the given FP-Tree of ranked items.
+    /// @param root The current node in the FP-Tree being processed, which represents a prefix.
+    /// @param item The item for which the conditional transaction database is being generated.
+    /// @param compare The comparison of the ranks.
+    /// @return A new database containing the conditional transactions that correspond to the given item and node,
+    /// each prefix path once weighted by the frequency of its node.
+    auto conditional_transactions(const node_ptr &root, item_t item, const rank_compare_t &compare) -> database_t;
+
     /// @brief Implements the FP-Growth algorithm to find frequent itemsets in the given database.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
     /// @param database The database used to find frequent itemsets.
     /// @param min_support The minimum support threshold for considering an itemset as frequent.
     /// @return A collection of frequent itemsets that meet or exceed the minimum support.
     auto fp_growth_algorithm(const database_t &database, size_t min_support) -> itemsets_t;
 
     /// @brief Implements the FP-Growth algorithm to find frequent itemsets in the given database.
-    /// @param database A tuple containing the reduced database and item's frequencies.
+    /// The database is reduced and ranked in place, i.e. without copying the transactions.
+    /// @param database The database used to find frequent itemsets.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @return A collection of frequent itemsets that meet or exceed the minimum support.
+    auto fp_growth_algorithm(database_t &&database, size_t min_support) -> itemsets_t;
+
+    /// @brief Implements the FP-Growth algorithm to find frequent itemsets in the given database.
+    /// @param database A view of the reduced database and item's frequencies.
     /// @param min_support The minimum support threshold that an itemset must meet to be considered frequent.
     /// @return A collection of frequent itemsets that meet or exceed the minimum support.
-    auto fp_growth_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t;
+    auto fp_growth_algorithm_(const database_view_t &database, size_t min_support) -> itemsets_t;
+
+    /// @brief Implements the FP-Growth algorithm and stores the frequent itemsets with their support in a trie.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
+    /// @param database The database used to find frequent itemsets.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @return The trie of the frequent itemsets that meet or exceed the minimum support.
+    auto fp_growth_trie(const database_t &database, size_t min_support) -> itemset_trie_t;
+
+    /// @brief Implements the FP-Growth algorithm and appends the frequent itemsets with their support to a trie.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold that an itemset must meet to be considered frequent.
+    /// @param trie The trie to which the frequent itemsets are appended.
+    auto fp_growth_trie_(const database_view_t &database, size_t min_support, itemset_trie_t &trie) -> void;
+
+    /// @brief Implements the FP-Growth algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
+    /// @param database The database used to find frequent itemsets.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the FP-trees (optional).
+    auto fp_growth_algorithm(
+        const database_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the FP-Growth algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold that an itemset must meet to be considered frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the FP-trees (optional). Each tree is built in an arena on top of it,
+    /// which is released at once as soon as the tree's conditional databases have been mined.
+    auto fp_growth_algorithm_(
+        const database_view_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the FP-Growth algorithm, keeping only the compressed transactions while mining: The
+    /// database is reduced and ranked in place, compressed (see compressed_database_t) and released before the
+    /// FP-tree is built from the compressed transactions.
+    /// @param database The database used to find frequent itemsets.
+    /// @param min_support The minimum support threshold for considering an itemset as frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the FP-trees (optional).
+    auto fp_growth_compressed(
+        database_t &&database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the FP-Growth algorithm on a compressed database and passes each frequent itemset to a
+    /// sink as soon as it is found.
+    /// @param database A view of the compressed reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold that an itemset must meet to be considered frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the FP-trees (optional).
+    auto fp_growth_compressed_(
+        const compressed_database_view_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the FP-Growth algorithm on an FP-tree built beforehand (e.g. a cached one) and passes
+    /// each frequent itemset to a sink as soon as it is found. The tree is only read.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param root The root of the FP-tree of the reduced database (see build_fp_tree).
+    /// @param min_support The minimum support threshold that an itemset must meet to be considered frequent.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the conditional FP-trees (optional).
+    auto fp_growth_algorithm_(
+        const database_view_t &database,
+        const node_ptr &root,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
 }
@@ -29,17 +29,19 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include "itemset.h"
 #include "database.h"
+#include "compressed_database.h"
 
 namespace fim::fp_tree {
     struct node_t;
 
     using namespace fim;
-    using items_t = std::vector<item_t>;
+    using items_t = itemset_t;
 
     using node_ptr = std::shared_ptr<node_t>;
-    using children_t = std::vector<node_ptr>;
+    using children_t = std::pmr::vector<node_ptr>;
 
     /// @brief Represents a node in an FP-tree.
     struct node_t : std::enable_shared_from_this<node_t> {
@@ -54,7 +56,12 @@ namespace fim::fp_tree {
         /// @param item The item to be stored in the node.
         /// @param frequency The frequency of the item.
         /// @param parent An optional shared pointer to the parent node.
-        node_t(item_t item, size_t frequency, const std::shared_ptr<node_t> &parent = nullptr);
+        /// @param resource The memory resource of the node's children (optional).
+        node_t(
+            item_t item,
+            size_t frequency,
+            const std::shared_ptr<node_t> &parent = nullptr,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
         /// @brief Default constructor for node_t.
         node_t() = default;
@@ -64,10 +71,12 @@ namespace fim::fp_tree {
         bool is_root() const;
 
         /// @brief Creates and returns the root node for an FP-tree.
+        /// @param resource The memory resource from which all nodes of the tree are allocated (optional).
         /// @return A shared pointer to the newly created root node.
-        static node_ptr create_root();
+        static node_ptr create_root(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
-        /// @brief Adds a child node with the specified item and frequency to this node.
+        /// @brief Adds a child node with the specified item and frequency to this node. The child is allocated from
+        /// the memory resource of this node.
         /// @param child_item The item for the new child node.
         /// @param child_frequency The frequency of the child item.
         /// @return A shared pointer to the newly added child node.
@@ -109,15 +118,29 @@ namespace fim::fp_tree {
     /// @return A new collection of itemsets where the specified item has been added to each original subset.
     auto insert_into_each_itemsets(const itemsets_t &itemsets, item_t item) -> itemsets_t;
 
-    /// @brief Filters and sorts the items in the input itemset according to the order of frequent items.
-    /// @param itemset The original itemset to be filtered and sorted.
+    /// @brief Filters and sorts the items in the input transaction according to the order of frequent items.
+    /// @param transaction The original transaction to be filtered and sorted.
     /// @param freq_items A list of frequent items, used to determine the order.
     /// @return Sorted list of items, sorted by their frequency.
-    auto filter_and_sort_items(const itemset_t &itemset, const items_t &freq_items) -> items_t;
+    auto filter_and_sort_items(const transaction_t &transaction, const items_t &freq_items) -> items_t;
 
     /// @brief Builds an FP-tree from the given transaction database using the frequent items list.
     /// @param database The transaction database containing the items and their frequencies.
     /// @param freq_items The list of frequent items used to build the FP-tree.
+    /// @param resource The memory resource from which the nodes are allocated (optional).
     /// @return A shared pointer to the root node of the newly constructed FP-tree.
-    auto build_fp_tree(const database_t &database, const items_t &freq_items) -> node_ptr;
+    auto build_fp_tree(
+        const database_t &database,
+        const items_t &freq_items,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> node_ptr;
+
+    /// @brief Builds an FP-tree from the given compressed transaction database using the frequent items list.
+    /// @param database The compressed transaction database, decoded sequentially.
+    /// @param freq_items The list of frequent items used to build the FP-tree.
+    /// @param resource The memory resource from which the nodes are allocated (optional).
+    /// @return A shared pointer to the root node of the newly constructed FP-tree.
+    auto build_fp_tree(
+        const compressed_database_t &database,
+        const items_t &freq_items,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> node_ptr;
 }
@@ -0,0 +1,104 @@
+/// @file huge_page_resource.h
+/// @brief A memory resource backed by huge pages for large mining structures.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace fim {
+    // A memory resource which serves allocations from large chunks mapped with mmap and advised to be backed by
+    // transparent huge pages (MADV_HUGEPAGE), so that large node-based structures like FP-trees or tidsets cause
+    // fewer TLB misses. The chunks are only unmapped when the resource is destroyed; deallocated blocks are kept
+    // and reused for allocations of the same size (like the buffers of the monotonic arenas of the miners).
+    // If mmap is unavailable, disabled by the library configuration (FIM_HUGE_PAGES) or fails, the resource falls
+    // back to its upstream resource. It is not thread-safe.
+    class huge_page_resource_t : public std::pmr::memory_resource {
+    public:
+        /// The size of a huge page (2 MiB on x86-64 and most ARM64 configurations).
+        static constexpr size_t huge_page_size = size_t{1} << 21;
+
+        /// The default size of the chunks that are mapped at once.
+        static constexpr size_t default_chunk_size = 32 * huge_page_size;
+
+        /// @brief Constructs a resource that maps chunks of the given size.
+        /// @param chunk_size The minimum size of a mapped chunk (rounded up to whole huge pages).
+        /// @param upstream The resource used if no memory can be mapped.
+        explicit huge_page_resource_t(
+            size_t chunk_size = default_chunk_size,
+            std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+
+        huge_page_resource_t(const huge_page_resource_t &) = delete;
+
+        auto operator=(const huge_page_resource_t &) -> huge_page_resource_t & = delete;
+
+        /// @brief Unmaps all chunks.
+        ~huge_page_resource_t() override;
+
+        /// @brief Gets the number of bytes mapped by the resource.
+        [[nodiscard]] auto mapped_bytes() const -> size_t;
+
+        /// @brief Gets whether the kernel accepted the advice to back the chunks by huge pages.
+        [[nodiscard]] auto huge_pages_advised() const -> bool;
+
+        /// @brief Gets the number of huge pages that currently back the chunks (as reported by /proc/self/smaps).
+        /// @return The number of huge pages, which is 0 if transparent huge pages are unavailable.
+        [[nodiscard]] auto huge_pages() const -> size_t;
+
+        /// @brief Gets the number of bytes served by the upstream resource, because no memory could be mapped.
+        [[nodiscard]] auto upstream_bytes() const -> size_t;
+
+    private:
+        // A mapped chunk.
+        struct chunk_t {
+            std::byte *data{nullptr};
+            size_t size{0};
+        };
+
+        auto do_allocate(size_t bytes, size_t alignment) -> void * override;
+
+        auto do_deallocate(void *p, size_t bytes, size_t alignment) -> void override;
+
+        [[nodiscard]] auto do_is_equal(const memory_resource &other) const noexcept -> bool override;
+
+        // Maps a new chunk of at least the given size; returns false if mmap is unavailable or fails.
+        auto map_chunk(size_t min_size) -> bool;
+
+        size_t chunk_size_;
+        std::pmr::memory_resource *upstream_;
+        std::vector<chunk_t> chunks_{};
+        std::byte *current_{nullptr}; ///< The next free byte of the last chunk.
+        std::byte *end_{nullptr}; ///< The end of the last chunk.
+        bool advised_{false};
+        size_t upstream_bytes_{0};
+        std::unordered_map<size_t, std::vector<void *> > free_blocks_{}; ///< Deallocated blocks by their size.
+    };
+}
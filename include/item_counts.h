@@ -28,35 +28,166 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
 #include "itemset.h"
+#include "itemset_trie.h"
 
 namespace fim {
     struct database_t;
+    struct compressed_database_t;
 
     using support_values_t = std::vector<float>;
     using counts_t = std::vector<size_t>;
 
+    // The rank type: Dense identifier of a frequent item, ordered by the item's frequency.
+    using rank_t = std::uint32_t;
+
     // Item counting
     struct item_counts_t : std::unordered_map<item_t, size_t> {
         using std::unordered_map<item_t, size_t>::unordered_map;
 
+        /// True if the items are dense ranks, i.e. the item order equals the order of their frequencies.
+        bool ranked{false};
+
         /// @brief Gets the frequent items that meet the minimum support threshold.
         /// @param min_support The minimal support threshold for filtering frequent items.
-        /// @return A sorted list of items that meet the minimum support threshold.
+        /// @return A list of items that meet the minimum support threshold, sorted by descending support
+        /// (items with equal support are sorted ascending).
         [[nodiscard]] auto get_frequent_items(size_t min_support) const -> itemset_t;
 
         /// @brief Gets a comparator for items based on their support (count).
+        /// For ranked item counts the comparator is a plain integer comparison.
         /// @return A comparison function that can be used to compare two items based on their support.
         [[nodiscard]] auto get_item_compare() const -> item_compare_t;
 
         /// @brief Gets a comparator for items based on their support (count) in reverse order.
         /// @return A comparison function that can be used to compare two items based on their support in reverse order.
         auto get_item_reverse_compare() const -> item_compare_t;
+
+        /// @brief Invokes a function with the statically typed comparator of the items, i.e. `rank_compare_t`
+        /// for ranked item counts and the comparator returned by `get_item_compare` otherwise.
+        /// @param function The function to invoke with the comparator.
+        /// @return The result of the function.
+        template<typename Function>
+        auto visit_item_compare(Function &&function) const -> decltype(auto) {
+            return ranked ? function(rank_compare_t{}) : function(get_item_compare());
+        }
     };
 
-    // Item set counting
-    struct itemset_counts_t : std::unordered_map<itemset_t, size_t, itemset_hash> {
-        using std::unordered_map<itemset_t, size_t, itemset_hash>::unordered_map;
+    // Mapping between the items and their dense ranks (ascending by support, ties by item).
+    struct item_ranks_t {
+        itemset_t items{}; ///< The items indexed by their rank (reverse dictionary).
+        counts_t counts{}; ///< The counts indexed by the item's rank.
+        std::unordered_map<item_t, rank_t> ranks{}; ///< The rank of each frequent item.
+
+        /// @brief Creates the ranks of all frequent items.
+        /// @param item_counts The frequencies of the items.
+        /// @param min_support The minimum support threshold used to filter infrequent items.
+        /// @return The mapping between the frequent items and their ranks.
+        static auto create(const item_counts_t &item_counts, size_t min_support) -> item_ranks_t;
+
+        /// @brief Gets the number of ranked items.
+        /// @return The number of ranked items.
+        [[nodiscard]] auto size() const -> size_t;
+
+        /// @brief Checks if the given item has a rank, i.e. if the item is frequent.
+        /// @param item The item to check.
+        /// @return True if the item has a rank, false otherwise.
+        [[nodiscard]] auto contains(const item_t &item) const -> bool;
+
+        /// @brief Gets the rank of the given item.
+        /// @param item The frequent item.
+        /// @return The rank of the item.
+        [[nodiscard]] auto get_rank(const item_t &item) const -> rank_t;
+
+        /// @brief Gets the item of the given rank.
+        /// @param rank The rank of the item.
+        /// @return The original item.
+        [[nodiscard]] auto get_item(rank_t rank) const -> item_t;
+
+        /// @brief Gets the item counts of the ranked items, i.e. ranks mapped to their counts.
+        /// @return The item counts keyed by rank.
+        [[nodiscard]] auto get_rank_counts() const -> item_counts_t;
+
+        /// @brief Maps an itemset of ranks back to the original items.
+        /// @param itemset The itemset of ranks.
+        /// @return The itemset of the original items.
+        [[nodiscard]] auto to_items(const transaction_t &itemset) const -> itemset_t;
+
+        /// @brief Maps a collection of itemsets of ranks back to the original items.
+        /// @param itemsets The itemsets of ranks.
+        /// @return The itemsets of the original items.
+        [[nodiscard]] auto to_items(const itemsets_t &itemsets) const -> itemsets_t;
+
+        /// @brief Maps a trie of itemsets of ranks back to the original items.
+        /// @param trie The trie of ranks.
+        /// @return The trie of the original items.
+        [[nodiscard]] auto to_items(itemset_trie_t trie) const -> itemset_trie_t;
+
+        /// @brief Creates a sink that maps itemsets of ranks back to the original items before passing them on.
+        /// @param sink The sink receiving the itemsets of the original items.
+        /// @return The sink receiving the itemsets of ranks.
+        [[nodiscard]] auto to_items(const itemset_sink_t &sink) const -> itemset_sink_t;
+    };
+
+    // Item set counting: A flat hash table with open addressing (linear probing). The itemsets are stored one
+    // after another in an arena (like the transactions of database_t) and the slots refer to them by index.
+    struct itemset_counts_t {
+        std::vector<item_t> items{}; ///< The items of all itemsets, stored one itemset after another.
+        std::vector<size_t> offsets{0}; ///< The start of each itemset in `items`, followed by the end of the last.
+        counts_t counts{}; ///< The count of each itemset.
+        std::vector<std::uint64_t> slots{}; ///< The upper hash bits and the index + 1 of an itemset; 0 if empty.
+
+        itemset_counts_t() = default;
+
+        /// @brief Gets the number of itemsets.
+        /// @return The number of itemsets.
+        [[nodiscard]] auto size() const -> size_t { return counts.size(); }
+
+        /// @brief Checks if the table contains no itemsets.
+        /// @return True if the table is empty, false otherwise.
+        [[nodiscard]] auto empty() const -> bool { return counts.empty(); }
+
+        /// @brief Gets the itemset at the given index (in the order of insertion).
+        /// @param index The index of the itemset.
+        /// @return A view of the items of the itemset.
+        [[nodiscard]] auto get_itemset(const size_t index) const -> transaction_t {
+            return {items.data() + offsets[index], items.data() + offsets[index + 1]};
+        }
+
+        /// @brief Reserves memory for the given number of itemsets and items.
+        /// @param num_itemsets The number of itemsets.
+        /// @param num_items The total number of items of all itemsets.
+        auto reserve(size_t num_itemsets, size_t num_items = 0) -> void;
+
+        /// @brief Gets the index of an itemset.
+        /// @param itemset The itemset to find.
+        /// @return The index of the itemset or std::nullopt if the table does not contain it.
+        [[nodiscard]] auto find(const transaction_t &itemset) const -> std::optional<size_t>;
+
+        /// @brief Inserts an itemset with a count of zero, unless the table contains it already.
+        /// @param itemset The itemset to insert.
+        /// @return The index of the itemset.
+        auto insert(const transaction_t &itemset) -> size_t;
+
+        /// @brief Gets the count of an itemset, which is inserted if the table does not contain it.
+        /// @param itemset The itemset.
+        /// @return A reference to the count of the itemset.
+        auto operator[](const transaction_t &itemset) -> size_t &;
+
+        /// @brief Checks if the table contains the given itemset.
+        /// @param itemset The itemset to check.
+        /// @return True if the table contains the itemset, false otherwise.
+        [[nodiscard]] auto contains(const transaction_t &itemset) const -> bool;
+
+        /// @brief Gets the count of an itemset contained in the table.
+        /// @param itemset The itemset.
+        /// @return The count of the itemset.
+        /// @throws std::out_of_range If the table does not contain the itemset.
+        [[nodiscard]] auto at(const transaction_t &itemset) const -> size_t;
 
         /// @brief Creates a map of itemsets and their corresponding counts from the given transactions and itemsets.
         /// @param transactions A collection of transactions where each transaction is a set of items.
@@ -68,15 +199,99 @@ namespace fim {
             const itemsets_t &itemsets,
             const item_compare_t &compare) -> itemset_counts_t;
 
+        /// @brief Creates a map of itemsets and their corresponding counts for ranked items.
+        /// @param transactions A collection of transactions where each transaction is a set of ranks.
+        /// @param itemsets A collection of itemsets for which counts need to be calculated.
+        /// @param compare The comparison of the ranks.
+        /// @return A map (itemset_counts_t) that associates each itemset with its frequency count in the transactions.
+        static auto create_itemset_counts(
+            const database_t &transactions,
+            const itemsets_t &itemsets,
+            const rank_compare_t &compare) -> itemset_counts_t;
+
+        /// @brief Creates a map of itemsets and their corresponding counts from a compressed database. The
+        /// transactions are decoded once and each one is matched against all itemsets.
+        /// @param transactions A compressed database of transactions.
+        /// @param itemsets A collection of itemsets for which counts need to be calculated.
+        /// @param compare A comparison function used to compare items in the itemsets.
+        /// @return A map (itemset_counts_t) that associates each itemset with its frequency count in the transactions.
+        static auto create_itemset_counts(
+            const compressed_database_t &transactions,
+            const itemsets_t &itemsets,
+            const item_compare_t &compare) -> itemset_counts_t;
+
+        /// @brief Creates a map of itemsets and their corresponding counts for ranked items from a compressed database.
+        /// @param transactions A compressed database of transactions where each transaction is a set of ranks.
+        /// @param itemsets A collection of itemsets for which counts need to be calculated.
+        /// @param compare The comparison of the ranks.
+        /// @return A map (itemset_counts_t) that associates each itemset with its frequency count in the transactions.
+        static auto create_itemset_counts(
+            const compressed_database_t &transactions,
+            const itemsets_t &itemsets,
+            const rank_compare_t &compare) -> itemset_counts_t;
+
         /// @brief Gets the count (frequency) of a specific itemset.
         /// @param itemset The itemset whose count is to be retrieved.
         /// @return The count (frequency) of the specified itemset in the itemset counts map.
-        [[nodiscard]] auto get_count(const itemset_t &itemset) const -> size_t;
+        [[nodiscard]] auto get_count(const transaction_t &itemset) const -> size_t;
+
+        /// @brief Gets the counts of several itemsets. The lookups are batched, i.e. the hashes of a group of
+        /// itemsets are computed and their slots are prefetched before the slots are probed.
+        /// @param itemsets The itemsets whose counts are to be retrieved.
+        /// @return The count of each itemset (zero for itemsets not contained in the table).
+        [[nodiscard]] auto get_counts(const itemsets_t &itemsets) const -> counts_t;
+
+        /// @brief Gets the support of an itemset, i.e. its relative frequency.
+        /// @param itemset The itemset whose support is to be retrieved.
+        /// @param db_size The number of transactions.
+        /// @return The count of the itemset divided by the number of transactions.
+        auto get_support(const transaction_t &itemset, size_t db_size) const -> float;
+
+        /// @brief Doubles the number of slots and reinserts all itemsets.
+        auto grow() -> void;
+    };
+
+    // The counts of all pairs of ranks less than a given number, counted in one pass over a database of ranked
+    // items into an upper triangular array: The pairs (x, y) with x < y are stored row by row.
+    struct pair_counts_t {
+        /// The maximal number of pairs, so that the array does not exceed 256 MiB.
+        static constexpr size_t max_num_pairs = size_t{1} << 25;
+
+        size_t num_ranks{0}; ///< The number of counted ranks.
+        counts_t counts{}; ///< The count of each pair.
+        std::vector<size_t> rows{}; ///< The position of the (virtual) pair (x, 0) of each row x.
+
+        pair_counts_t() = default;
+
+        /// @brief Counts the pairs of ranks of a database.
+        /// @param database The database of ranked items, the items of each transaction sorted ascending.
+        /// @param num_ranks The number of counted ranks; pairs with a greater rank are ignored.
+        pair_counts_t(const database_t &database, size_t num_ranks);
+
+        /// @brief Checks if the pairs of a number of ranks fit into the array.
+        /// @param num_ranks The number of ranks.
+        /// @return True if the number of pairs does not exceed `max_num_pairs`, false otherwise.
+        static auto fits(const size_t num_ranks) -> bool {
+            return num_ranks < 2 || num_ranks * (num_ranks - 1) / 2 <= max_num_pairs;
+        }
+
+        /// @brief Gets the number of ranks to count, so that all frequent pairs are counted. The ranks ascend by
+        /// support, but a database may be ranked at a lower support than it is mined at, so the frequent ranks
+        /// need not be a prefix of the ranks.
+        /// @param rank_counts The counts of the ranks.
+        /// @param min_support The minimum support threshold.
+        /// @return The greatest frequent rank + 1, or 0 if there is none.
+        static auto get_num_ranks(const item_counts_t &rank_counts, size_t min_support) -> size_t;
+
+        /// @brief Gets the count of a pair of counted ranks.
+        /// @param x The smaller rank.
+        /// @param y The greater rank.
+        /// @return The count of the pair.
+        [[nodiscard]] auto get_count(const item_t x, const item_t y) const -> size_t { return counts[rows[x] + y]; }
 
-        /// @brief
-        /// @param itemset
-        /// @param db_size
-        /// @return
-        auto get_support(const itemset_t &itemset, size_t db_size) const -> float;
+        /// @brief Gets the pairs meeting the minimum support threshold in lexicographical order.
+        /// @param min_support The minimum support threshold.
+        /// @return A tuple of the frequent pairs and their counts.
+        [[nodiscard]] auto get_frequent_pairs(size_t min_support) const -> std::tuple<itemsets_t, counts_t>;
     };
 }
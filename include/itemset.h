@@ -29,23 +29,66 @@
 #pragma once
 
 #include <ranges>
+#include <span>
 #include <vector>
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
+#include "simd.h"
+#include "small_vector.h"
+
+// The width of an item in bits (16, 32 or 64), selected at compile time. Narrow items reduce the memory of
+// itemsets, transactions, trees and tidset keys, but the items of the databases must fit into that width.
+#ifndef FIM_ITEM_WIDTH
+#define FIM_ITEM_WIDTH 64
+#endif
 
 namespace fim {
     // Forward declaration
     struct database_t;
 
+    static_assert(FIM_ITEM_WIDTH == 16 || FIM_ITEM_WIDTH == 32 || FIM_ITEM_WIDTH == 64,
+                  "FIM_ITEM_WIDTH must be 16, 32 or 64");
+
     // The prefix type: Represents a single item.
-    using item_t = unsigned long;
+    using item_t = std::conditional_t<FIM_ITEM_WIDTH == 16, std::uint16_t,
+        std::conditional_t<FIM_ITEM_WIDTH == 32, std::uint32_t, unsigned long> >;
     using item_compare_t = std::function<bool(const item_t &, const item_t &)>;
 
     // Default comparison function for items.
     auto default_item_compare(const item_t &i, const item_t &j) -> bool;
 
+    // Comparison of ranked items: A plain integer comparison, which (unlike item_compare_t) can be inlined.
+    struct rank_compare_t {
+        constexpr auto operator()(const item_t &i, const item_t &j) const -> bool {
+            return i < j;
+        }
+    };
+
+    struct itemset_t;
+
+    // The transaction type: A non-owning view of the items of a transaction (see database_t).
+    struct transaction_t : std::span<const item_t> {
+        using std::span<const item_t>::span;
+
+        /// @brief Copies the items of the transaction into an itemset.
+        /// @return A new itemset with the items of the transaction.
+        [[nodiscard]] auto to_itemset() const -> itemset_t;
+
+        /// @brief Checks if two transactions contain the same items in the same order.
+        friend auto operator==(const transaction_t &x, const transaction_t &y) -> bool {
+            return std::ranges::equal(x, y);
+        }
+    };
+
+    // The number of items an itemset stores without heap allocation (64 bytes of items, independent of their width).
+    constexpr std::size_t itemset_inline_capacity = 64 / sizeof(item_t);
+
     // The suffix type: Represents a set of items (used for frequent itemsets).
-    struct itemset_t : std::vector<item_t> {
-        using std::vector<item_t>::vector;
+    // Short itemsets are stored inline; only itemsets with more than `itemset_inline_capacity` items allocate.
+    struct itemset_t : small_vector<item_t, itemset_inline_capacity> {
+        using small_vector::small_vector;
 
         /// @brief Constructs an itemset from a single item.
         /// @param item The item to be added to the itemset.
@@ -69,7 +112,27 @@ namespace fim {
         /// @param superset The itemset to check against.
         /// @param comp The comparison function to use.
         /// @return True if the current itemset is a subset of the superset, false otherwise.
-        [[nodiscard]] auto is_subset(const itemset_t &superset, const item_compare_t &comp) const -> bool;
+        template<typename Compare>
+        [[nodiscard]] auto is_subset(const itemset_t &superset, const Compare &comp) const -> bool {
+            if constexpr (std::is_same_v<Compare, rank_compare_t>) {
+                return simd::includes<item_t>(superset, *this);
+            } else {
+                return std::ranges::includes(superset, *this, comp);
+            }
+        }
+
+        /// @brief Checks if the current itemset is a subset of a transaction using a custom comparison function.
+        /// @param transaction The transaction to check against.
+        /// @param comp The comparison function to use.
+        /// @return True if all items of the current itemset are contained in the transaction, false otherwise.
+        template<typename Compare>
+        [[nodiscard]] auto is_subset(const transaction_t &transaction, const Compare &comp) const -> bool {
+            if constexpr (std::is_same_v<Compare, rank_compare_t>) {
+                return simd::includes<item_t>(transaction, *this);
+            } else {
+                return std::ranges::includes(transaction, *this, comp);
+            }
+        }
 
         /// @brief Computes the union of the current itemset with another itemset.
         /// @param y The itemset to union with.
@@ -90,23 +153,57 @@ namespace fim {
         /// @brief Sorts the items in the itemset.
         /// @param compare The comparison function to use for sorting.
         /// @return A reference to the sorted itemset.
-        auto sort_itemset(const item_compare_t &compare) -> itemset_t &;
+        template<typename Compare>
+        auto sort_itemset(const Compare &compare) -> itemset_t & {
+            std::ranges::sort(*this, compare);
+            return *this;
+        }
 
         /// @brief Sorts the items in the itemset and returns a new sorted itemset.
         /// @param compare The comparison function to use for sorting.
         /// @return A new itemset with sorted items.
-        [[nodiscard]] auto sort_itemset(const item_compare_t &compare) const -> itemset_t;
+        template<typename Compare>
+        [[nodiscard]] auto sort_itemset(const Compare &compare) const -> itemset_t {
+            return itemset_t{*this}.sort_itemset(compare);
+        }
     };
 
+    /// @brief Compares two transactions lexicographically using a custom comparison function.
+    /// A longer transaction precedes its own prefix.
+    /// @param x The first transaction.
+    /// @param y The second transaction.
+    /// @param comp The comparison function to use (default is the integer comparison `rank_compare_t`).
+    /// @return True if `x` is lexicographically smaller than `y`, false otherwise.
+    template<typename Compare = rank_compare_t>
+    auto lexicographical_compare(const transaction_t &x, const transaction_t &y, const Compare &comp = {}) -> bool {
+        if constexpr (std::is_same_v<Compare, rank_compare_t>) {
+            return simd::lexicographical_compare<item_t>(x, y);
+        } else {
+            auto it_x = x.begin();
+            auto it_y = y.begin();
+
+            for (; it_x != x.end() && it_y != y.end(); ++it_x, ++it_y) {
+                if (comp(*it_x, *it_y)) {
+                    return true;
+                }
+
+                if (comp(*it_y, *it_x)) {
+                    return false;
+                }
+            }
+            return std::distance(it_x, x.end()) > std::distance(it_y, y.end());
+        }
+    }
+
     /// @brief Compares two itemsets lexicographically using a custom comparison function.
     /// @param x The first itemset.
     /// @param y The second itemset.
-    /// @param comp The comparison function to use (default is `default_item_compare`).
+    /// @param comp The comparison function to use (default is the integer comparison `rank_compare_t`).
     /// @return True if `x` is lexicographically smaller than `y`, false otherwise.
-    auto lexicographical_compare(
-        const itemset_t &x,
-        const itemset_t &y,
-        const item_compare_t &comp = default_item_compare) -> bool;
+    template<typename Compare = rank_compare_t>
+    auto lexicographical_compare(const itemset_t &x, const itemset_t &y, const Compare &comp = {}) -> bool {
+        return lexicographical_compare(transaction_t{x}, transaction_t{y}, comp);
+    }
 
     // Collection of prefix sets: A vector of itemsets.
     struct itemsets_t : std::vector<itemset_t> {
@@ -137,12 +234,24 @@ namespace fim {
         /// @brief Sorts each itemset in the collection using the provided comparison function.
         /// @param compare The comparison function to use.
         /// @return The updated collection of itemsets.
-        auto sort_each_itemset(const item_compare_t &compare) -> itemsets_t;
+        template<typename Compare>
+        auto sort_each_itemset(const Compare &compare) -> itemsets_t {
+            for (auto &itemset: *this) {
+                itemset.sort_itemset(compare);
+            }
+            return *this;
+        }
     };
 
-    // Hash function for itemsets (used in hash-based containers like unordered_map).
+    // Receives the frequent itemsets while they are mined: A view of the itemset, which is only valid during the
+    // call, and its support.
+    using itemset_sink_t = std::function<void(const transaction_t &itemset, size_t support)>;
+
+    // Hash function for itemsets (used in hash-based containers like unordered_map and itemset_counts_t).
+    // Every item is mixed in by a multiplication and the result is finalized by the SplitMix64 mixer,
+    // so that all bits of the hash depend on all items.
     struct itemset_hash {
-        auto operator()(const itemset_t &itemset) const -> std::size_t;
+        auto operator()(const transaction_t &itemset) const -> std::size_t;
     };
 
     /// @brief Overloads the output stream operator to print an itemset to an output stream.
@@ -168,4 +277,9 @@ namespace fim {
     /// @param y The second itemset.
     /// @return True if `x` is a subset of `y`, false otherwise.
     auto is_subset(const itemset_t &x, const itemset_t &y) -> bool;
+
+    /// @brief Creates a sink that appends the received itemsets to a collection.
+    /// @param itemsets The collection the itemsets are appended to.
+    /// @return The sink appending to the collection.
+    auto append_to(itemsets_t &itemsets) -> itemset_sink_t;
 }
@@ -0,0 +1,148 @@
+/// @file itemset_trie.h
+/// @brief A prefix trie storing the frequent itemsets found by a miner.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include "itemset.h"
+
+namespace fim {
+    // An itemset of a trie together with its support.
+    struct trie_entry_t {
+        itemset_t itemset{};
+        size_t support{};
+    };
+
+    // A prefix trie of itemsets: Each node represents the itemset of the items on its path from the root and
+    // refers to its parent by index, so itemsets sharing a prefix share the nodes of the prefix. The miners append
+    // an itemset in O(1) by adding a single node below the node of its prefix.
+    struct itemset_trie_t {
+        /// The parent index of the nodes of 1-itemsets.
+        static constexpr size_t root = std::numeric_limits<size_t>::max();
+
+        // A node of the trie.
+        struct node_t {
+            size_t parent{root}; ///< The index of the parent node or `root`.
+            item_t item{}; ///< The last item of the itemset.
+            size_t support{}; ///< The support of the itemset.
+        };
+
+        // Iterator over the itemsets of the trie in the order of their insertion.
+        struct const_iterator {
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = trie_entry_t;
+            using difference_type = std::ptrdiff_t;
+
+            const itemset_trie_t *trie{nullptr};
+            size_t index{};
+
+            auto operator*() const -> trie_entry_t { return {trie->get_itemset(index), trie->get_support(index)}; }
+
+            auto operator++() -> const_iterator & {
+                ++index;
+                return *this;
+            }
+
+            auto operator++(int) -> const_iterator {
+                auto it = *this;
+                ++index;
+                return it;
+            }
+
+            auto operator==(const const_iterator &other) const -> bool { return index == other.index; }
+        };
+
+        std::vector<node_t> nodes{}; ///< The nodes, each parent stored before its children.
+
+        /// @brief Gets the number of itemsets.
+        /// @return The number of itemsets.
+        [[nodiscard]] auto size() const -> size_t { return nodes.size(); }
+
+        /// @brief Checks if the trie contains no itemsets.
+        /// @return True if the trie is empty, false otherwise.
+        [[nodiscard]] auto empty() const -> bool { return nodes.empty(); }
+
+        /// @brief Reserves memory for a number of itemsets.
+        /// @param capacity The number of itemsets.
+        auto reserve(const size_t capacity) -> void { nodes.reserve(capacity); }
+
+        /// @brief Adds the itemset that extends the itemset of a node by an item.
+        /// @param parent The node of the prefix or `root` for a 1-itemset.
+        /// @param item The item extending the prefix.
+        /// @param support The support of the new itemset.
+        /// @return The node of the new itemset.
+        auto add(const size_t parent, const item_t item, const size_t support) -> size_t {
+            nodes.push_back({parent, item, support});
+            return nodes.size() - 1;
+        }
+
+        /// @brief Gets the itemset of a node, i.e. the items along the path from the root to the node.
+        /// @param node The index of the node.
+        /// @return The itemset, ordered from the root to the node.
+        [[nodiscard]] auto get_itemset(size_t node) const -> itemset_t;
+
+        /// @brief Gets the support of the itemset of a node.
+        /// @param node The index of the node.
+        /// @return The support of the itemset.
+        [[nodiscard]] auto get_support(const size_t node) const -> size_t { return nodes[node].support; }
+
+        /// @brief Replaces the items of the nodes from a given index on, e.g. to map ranks back to items.
+        /// @param function The function mapping an item to its replacement.
+        /// @param first The index of the first node to map.
+        /// @return A reference to the updated trie.
+        template<typename Function>
+        auto transform_items(const Function &function, const size_t first = 0) -> itemset_trie_t & {
+            for (auto i = first; i < nodes.size(); ++i) {
+                nodes[i].item = function(nodes[i].item);
+            }
+            return *this;
+        }
+
+        /// @brief Converts the trie into a flat collection of itemsets.
+        /// @return The itemsets in the order of their insertion.
+        [[nodiscard]] auto to_itemsets() const -> itemsets_t;
+
+        [[nodiscard]] auto begin() const -> const_iterator { return {this, 0}; }
+        [[nodiscard]] auto end() const -> const_iterator { return {this, nodes.size()}; }
+    };
+
+    // Builds a trie from a stream of itemsets in pre-order, i.e. every itemset follows its prefix or another
+    // extension of its prefix, as emitted by the depth-first miners. It can be passed as an itemset_sink_t.
+    struct trie_builder_t {
+        itemset_trie_t &trie; ///< The trie the itemsets are added to.
+        std::vector<size_t> path{}; ///< The nodes of the items of the last itemset.
+
+        /// @brief Adds an itemset below the node of its prefix.
+        /// @param itemset The itemset, whose prefix is a prefix of the last itemset.
+        /// @param support The support of the itemset.
+        auto operator()(const transaction_t &itemset, size_t support) -> void;
+    };
+}
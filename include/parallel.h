@@ -0,0 +1,83 @@
+/// @file parallel.h
+/// @brief Helpers for splitting work across threads.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace fim::parallel {
+    /// @brief Gets the number of threads to use for a task.
+    /// @param num_threads The requested number of threads (0 uses the hardware concurrency).
+    /// @param num_tasks The number of independent units of work; no more threads than tasks are used.
+    /// @return The number of threads, at least one.
+    inline auto get_num_threads(const size_t num_threads, const size_t num_tasks) -> size_t {
+        const auto requested = num_threads != 0
+                                   ? num_threads
+                                   : static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+        return std::max<size_t>(1, std::min(requested, num_tasks));
+    }
+
+    /// @brief Splits the range [0, size) into `num_threads` contiguous blocks and calls the function for each
+    /// block on its own thread. The first block is processed by the calling thread.
+    /// @param size The size of the range.
+    /// @param num_threads The number of blocks (see get_num_threads).
+    /// @param function The function called as `function(thread, begin, end)`.
+    template<typename Function>
+    auto for_each_block(const size_t size, const size_t num_threads, Function &&function) -> void {
+        const auto block_begin = [&](const size_t thread) { return size * thread / num_threads; };
+
+        std::vector<std::jthread> threads{};
+        threads.reserve(num_threads - 1);
+
+        for (size_t thread = 1; thread < num_threads; ++thread) {
+            threads.emplace_back([&, thread] { function(thread, block_begin(thread), block_begin(thread + 1)); });
+        }
+        function(size_t{0}, block_begin(0), block_begin(1));
+    }
+
+    /// @brief Calls the function for each task in [0, num_tasks) using `num_threads` threads, where each thread
+    /// takes the next unprocessed task. Tasks should be ordered by descending cost for an even load.
+    /// @param num_tasks The number of tasks.
+    /// @param num_threads The number of threads (see get_num_threads).
+    /// @param function The function called as `function(task)`.
+    template<typename Function>
+    auto for_each_task(const size_t num_tasks, const size_t num_threads, Function &&function) -> void {
+        std::atomic<size_t> next_task{0};
+
+        for_each_block(num_threads, num_threads, [&](size_t, size_t, size_t) {
+            for (auto task = next_task++; task < num_tasks; task = next_task++) {
+                function(task);
+            }
+        });
+    }
+}
@@ -28,9 +28,13 @@
 
 #pragma once
 
+#include <list>
+#include <memory_resource>
 #include <ranges>
 #include "itemset.h"
+#include "itemset_trie.h"
 #include "database.h"
+#include "compressed_database.h"
 
 namespace fim::algorithm::relim {
     using std::views::transform;
@@ -46,9 +50,9 @@ namespace fim::algorithm::relim {
         itemset_t itemset{};
     };
 
-    /// List of suffixes.
-    struct suffixes_t : std::list<suffix_t> {
-        using std::list<suffix_t>::list;
+    /// List of suffixes, whose nodes are allocated from a memory resource.
+    struct suffixes_t : std::pmr::list<suffix_t> {
+        using std::pmr::list<suffix_t>::list;
 
         /// Adds an itemset to the list, maintaining lexicographical order.
         /// @param itemset The itemset to be added to the list.
@@ -58,6 +62,15 @@ namespace fim::algorithm::relim {
             const itemset_t &itemset,
             const item_compare_t &compare,
             size_t count = 1) -> void;
+
+        /// Adds an itemset of ranked items to the list, maintaining lexicographical order.
+        /// @param itemset The itemset to be added to the list.
+        /// @param compare The comparison of the ranks.
+        /// @param count The current number of items in the list.
+        auto add_itemset(
+            const itemset_t &itemset,
+            const rank_compare_t &compare,
+            size_t count = 1) -> void;
     };
 
     /// Head element
@@ -71,44 +84,142 @@ namespace fim::algorithm::relim {
     using header_t = std::vector<header_element_t>;
 
     /// @brief A structure that represents a conditional database use for RElim algorithm.
-    struct conditional_database_t {
+    /// @tparam Compare The type of the comparison function used to compare items.
+    template<typename Compare>
+    struct basic_conditional_database_t {
         header_t header{};
-        item_compare_t compare{};
+        Compare compare{};
 
         /// @brief Constructs a conditional database from a set of frequent items.
         /// @param freq_items A set of frequent items.
         /// @param compare A comparison function used to compare items.
-        explicit conditional_database_t(const itemset_t &freq_items, const item_compare_t &compare);
+        /// @param resource The memory resource of the suffix lists (optional).
+        explicit basic_conditional_database_t(
+            const itemset_t &freq_items,
+            const Compare &compare,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
         /// @brief Creates the initial conditional database.
         /// @param database The original database that contains all transactions.
         /// @param freq_items A set of frequent items.
         /// @param compare A comparison function used to compare items.
+        /// @param resource The memory resource of the suffix lists (optional).
         /// @return A new conditional database created from the given parameters.
         static auto create_initial_database(
             const database_t &database,
             const itemset_t &freq_items,
-            const item_compare_t &compare) -> conditional_database_t;
+            const Compare &compare,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> basic_conditional_database_t;
+
+        /// @brief Creates the initial conditional database from a compressed database.
+        /// @param database The compressed database that contains all transactions, decoded sequentially.
+        /// @param freq_items A set of frequent items.
+        /// @param compare A comparison function used to compare items.
+        /// @param resource The memory resource of the suffix lists (optional).
+        /// @return A new conditional database created from the given parameters.
+        static auto create_initial_database(
+            const compressed_database_t &database,
+            const itemset_t &freq_items,
+            const Compare &compare,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> basic_conditional_database_t;
 
         /// @brief Returns a conditional database filtered by the prefix.
+        /// @param resource The memory resource of the suffix lists of the new database (optional).
         /// @return A new conditional database that only includes transactions with the given prefix.
-        [[nodiscard]] auto create_prefix_database() const -> conditional_database_t;
+        [[nodiscard]] auto create_prefix_database(
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource()) const
+            -> basic_conditional_database_t;
 
         /// @brief Eliminates items from the database based on the given prefix database.
         /// @param prefix_db A conditional database.
         /// @return The item that is eliminated after filtering the prefix database.
-        auto eliminate(const conditional_database_t &prefix_db) -> item_t;
+        auto eliminate(const basic_conditional_database_t &prefix_db) -> item_t;
     };
 
+    /// Conditional database whose items are compared by a comparison function given at runtime.
+    using conditional_database_t = basic_conditional_database_t<item_compare_t>;
+
+    /// Conditional database of ranked items.
+    using ranked_conditional_database_t = basic_conditional_database_t<rank_compare_t>;
+
+    extern template struct basic_conditional_database_t<item_compare_t>;
+    extern template struct basic_conditional_database_t<rank_compare_t>;
+
     /// @brief Implements the RElim algorithm to find frequent itemsets in the database.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
     /// @param database The input database containing transactions.
     /// @param min_support The minimum support threshold used to filter frequent itemsets.
     /// @return A collection of frequent itemsets that meet the minimum support criteria.
     auto relim_algorithm(const database_t &database, size_t min_support) -> itemsets_t;
 
     /// @brief Implements the RElim algorithm to find frequent itemsets in the database.
-    /// @param database A tuple containing the reduced database and item's frequencies.
+    /// @param database A view of the reduced database and item's frequencies.
     /// @param min_support The minimum support threshold used to filter frequent itemsets.
     /// @return A collection of frequent itemsets that meet the minimum support criteria.
-    auto relim_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t;
+    auto relim_algorithm_(const database_view_t &database, size_t min_support) -> itemsets_t;
+
+    /// @brief Implements the RElim algorithm and stores the frequent itemsets with their support in a trie.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
+    /// @param database The input database containing transactions.
+    /// @param min_support The minimum support threshold used to filter frequent itemsets.
+    /// @return The trie of the frequent itemsets that meet the minimum support criteria.
+    auto relim_trie(const database_t &database, size_t min_support) -> itemset_trie_t;
+
+    /// @brief Implements the RElim algorithm and appends the frequent itemsets with their support to a trie.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold used to filter frequent itemsets.
+    /// @param trie The trie to which the frequent itemsets are appended.
+    auto relim_trie_(const database_view_t &database, size_t min_support, itemset_trie_t &trie) -> void;
+
+    /// @brief Implements the RElim algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// The items are mapped to dense ranks and identical transactions are collapsed into weighted ones
+    /// before mining (see database_t::rank_reduction).
+    /// @param database The input database containing transactions.
+    /// @param min_support The minimum support threshold used to filter frequent itemsets.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the suffix lists (optional).
+    auto relim_algorithm(
+        const database_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the RElim algorithm and passes each frequent itemset to a sink as soon as it is found.
+    /// @param database A view of the reduced database and item's frequencies.
+    /// @param min_support The minimum support threshold used to filter frequent itemsets.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the suffix lists (optional). Each prefix database is built in an arena
+    /// on top of it, which is released at once as soon as the prefix database has been mined.
+    auto relim_algorithm_(
+        const database_view_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the RElim algorithm, keeping only the compressed transactions while mining: The database
+    /// is reduced, ranked and sorted in place, compressed (see compressed_database_t) and released before the
+    /// initial conditional database is built from the compressed transactions.
+    /// @param database The input database containing transactions.
+    /// @param min_support The minimum support threshold used to filter frequent itemsets.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the suffix lists (optional).
+    auto relim_compressed(
+        database_t &&database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
+
+    /// @brief Implements the RElim algorithm on a compressed database and passes each frequent itemset to a sink as
+    /// soon as it is found.
+    /// @param database A view of the compressed reduced database, sorted lexicographically, and item's frequencies.
+    /// @param min_support The minimum support threshold used to filter frequent itemsets.
+    /// @param sink The sink receiving the frequent itemsets and their support, each one after its prefix.
+    /// @param resource The memory resource of the suffix lists (optional).
+    auto relim_compressed_(
+        const compressed_database_view_t &database,
+        size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) -> void;
 }
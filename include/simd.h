@@ -0,0 +1,356 @@
+/// @file simd.h
+/// @brief Vectorized kernels for sorted arrays of items.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+// The kernels operate on arrays of distinct 16, 32 or 64-bit unsigned integers sorted in ascending order, like the
+// items of an itemset or a transaction. They compare a block of elements at once: 256 bits with AVX2, 128 bits
+// with SSE4.2 or a single element otherwise.
+namespace fim::simd {
+    /// @brief A block of consecutive elements that are compared at once.
+    /// @tparam T The element type (a 16, 32 or 64-bit unsigned integer).
+    template<typename T>
+    struct block_t {
+        static_assert(std::is_unsigned_v<T> && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8));
+
+#if defined(__AVX2__)
+        static constexpr size_t size = 32 / sizeof(T);
+
+        /// @brief Gets a bit mask of the positions at which two blocks hold equal elements (bit i for element i).
+        static auto equal_mask(const T *x, const T *y) -> unsigned {
+            const auto block_x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x));
+            const auto block_y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y));
+            return to_mask(equal(block_x, block_y));
+        }
+
+        /// @brief Gets a bit mask of the elements of a block that are equal to a value.
+        static auto equal_mask(const T *data, const T value) -> unsigned {
+            const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+            if constexpr (sizeof(T) == 8) {
+                return to_mask(equal(block, _mm256_set1_epi64x(static_cast<long long>(value))));
+            } else if constexpr (sizeof(T) == 4) {
+                return to_mask(equal(block, _mm256_set1_epi32(static_cast<int>(value))));
+            } else {
+                return to_mask(equal(block, _mm256_set1_epi16(static_cast<short>(value))));
+            }
+        }
+
+        /// @brief Gets a bit mask of the elements of block `x` that are equal to any element of block `y`.
+        /// Every element of `x` is compared with every element of `y` by rotating `y` through all lanes.
+        static auto match_mask(const T *x, const T *y) -> unsigned {
+            const auto block_x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x));
+            auto block_y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y));
+
+            auto matches = equal(block_x, block_y);
+            if constexpr (sizeof(T) == 8) {
+                for (size_t i = 1; i < size; ++i) {
+                    block_y = _mm256_permute4x64_epi64(block_y, 0b00'11'10'01);
+                    matches = _mm256_or_si256(matches, equal(block_x, block_y));
+                }
+            } else if constexpr (sizeof(T) == 4) {
+                const auto rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+                for (size_t i = 1; i < size; ++i) {
+                    block_y = _mm256_permutevar8x32_epi32(block_y, rotate);
+                    matches = _mm256_or_si256(matches, equal(block_x, block_y));
+                }
+            } else {
+                // the byte shift within each 128-bit lane takes the missing element from the swapped lanes
+                for (size_t i = 1; i < size; ++i) {
+                    block_y = _mm256_alignr_epi8(_mm256_permute2x128_si256(block_y, block_y, 0x01), block_y, 2);
+                    matches = _mm256_or_si256(matches, equal(block_x, block_y));
+                }
+            }
+            return to_mask(matches);
+        }
+
+        static auto equal(const __m256i x, const __m256i y) -> __m256i {
+            if constexpr (sizeof(T) == 8) {
+                return _mm256_cmpeq_epi64(x, y);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm256_cmpeq_epi32(x, y);
+            } else {
+                return _mm256_cmpeq_epi16(x, y);
+            }
+        }
+
+        static auto to_mask(const __m256i x) -> unsigned {
+            if constexpr (sizeof(T) == 8) {
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(x)));
+            } else if constexpr (sizeof(T) == 4) {
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(x)));
+            } else {
+                // packs the 16-bit lanes to bytes, so that each element yields a single bit
+                const auto bytes = _mm_packs_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+                return static_cast<unsigned>(_mm_movemask_epi8(bytes));
+            }
+        }
+
+#elif defined(__SSE4_2__)
+        static constexpr size_t size = 16 / sizeof(T);
+
+        static auto equal_mask(const T *x, const T *y) -> unsigned {
+            const auto block_x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x));
+            const auto block_y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(y));
+            return to_mask(equal(block_x, block_y));
+        }
+
+        static auto equal_mask(const T *data, const T value) -> unsigned {
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            if constexpr (sizeof(T) == 8) {
+                return to_mask(equal(block, _mm_set1_epi64x(static_cast<long long>(value))));
+            } else if constexpr (sizeof(T) == 4) {
+                return to_mask(equal(block, _mm_set1_epi32(static_cast<int>(value))));
+            } else {
+                return to_mask(equal(block, _mm_set1_epi16(static_cast<short>(value))));
+            }
+        }
+
+        static auto match_mask(const T *x, const T *y) -> unsigned {
+            const auto block_x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x));
+            auto block_y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(y));
+
+            auto matches = equal(block_x, block_y);
+            for (size_t i = 1; i < size; ++i) {
+                block_y = _mm_alignr_epi8(block_y, block_y, sizeof(T));
+                matches = _mm_or_si128(matches, equal(block_x, block_y));
+            }
+            return to_mask(matches);
+        }
+
+        static auto equal(const __m128i x, const __m128i y) -> __m128i {
+            if constexpr (sizeof(T) == 8) {
+                return _mm_cmpeq_epi64(x, y);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm_cmpeq_epi32(x, y);
+            } else {
+                return _mm_cmpeq_epi16(x, y);
+            }
+        }
+
+        static auto to_mask(const __m128i x) -> unsigned {
+            if constexpr (sizeof(T) == 8) {
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(x)));
+            } else if constexpr (sizeof(T) == 4) {
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(x)));
+            } else {
+                return static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(x, _mm_setzero_si128())));
+            }
+        }
+
+#else
+        static constexpr size_t size = 1;
+
+        static auto equal_mask(const T *x, const T *y) -> unsigned {
+            return *x == *y ? 1u : 0u;
+        }
+
+        static auto equal_mask(const T *data, const T value) -> unsigned {
+            return *data == value ? 1u : 0u;
+        }
+
+        static auto match_mask(const T *x, const T *y) -> unsigned {
+            return *x == *y ? 1u : 0u;
+        }
+#endif
+
+        /// The mask of a block whose elements are all equal.
+        static constexpr unsigned full_mask = (1u << size) - 1;
+    };
+
+    /// @brief Searches a value in a sorted array, starting at a position. Whole blocks of smaller elements are
+    /// skipped by comparing their last element, the block that may contain the value is compared at once.
+    /// @param data The sorted array.
+    /// @param pos The position to start at; set behind the value if it is found.
+    /// @param value The value to search.
+    /// @return True if the value is found, false otherwise.
+    template<typename T>
+    auto find_next(const std::span<const T> data, size_t &pos, const T value) -> bool {
+        using block = block_t<T>;
+
+        while (pos + block::size <= data.size() && data[pos + block::size - 1] < value) {
+            pos += block::size;
+        }
+
+        if (pos + block::size <= data.size()) {
+            const auto mask = block::equal_mask(data.data() + pos, value);
+            if (mask == 0) {
+                return false;
+            }
+            pos += std::countr_zero(mask) + 1;
+            return true;
+        }
+
+        while (pos < data.size() && data[pos] < value) {
+            ++pos;
+        }
+        if (pos < data.size() && data[pos] == value) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Visits the elements of a sorted array together with the information whether they are contained in
+    /// another sorted array. Both arrays are merged block by block: The blocks are compared element by element,
+    /// and the block with the smaller last element is advanced (both if their last elements are equal).
+    /// @param x The sorted array of the elements to visit.
+    /// @param y The sorted array to search in.
+    /// @param visit The function called with each element of `x` and whether it is contained in `y`. The merge
+    /// stops as soon as it returns false.
+    /// @return True if all elements have been visited, false if the merge has been stopped.
+    template<typename T, typename Visit>
+    auto merge_visit(const std::span<const T> x, const std::span<const T> y, const Visit &visit) -> bool {
+        using block = block_t<T>;
+
+        size_t i = 0;
+        size_t j = 0;
+        unsigned matches = 0;
+
+        while (i + block::size <= x.size() && j + block::size <= y.size()) {
+            matches |= block::match_mask(x.data() + i, y.data() + j);
+
+            const auto last_x = x[i + block::size - 1];
+            const auto last_y = y[j + block::size - 1];
+            if (last_y <= last_x) {
+                j += block::size;
+            }
+            if (last_x <= last_y) {
+                for (size_t k = 0; k < block::size; ++k) {
+                    if (not visit(x[i + k], ((matches >> k) & 1u) != 0)) {
+                        return false;
+                    }
+                }
+                i += block::size;
+                matches = 0;
+            }
+        }
+
+        // The elements of the remaining blocks are searched one by one. An element of the current block of `x`
+        // that has no match yet is greater than all elements of `y` before `j`, as those have been compared with it.
+        for (size_t k = 0; i + k < x.size(); ++k) {
+            const auto value = x[i + k];
+            auto found = k < block::size && ((matches >> k) & 1u) != 0;
+            if (not found) {
+                while (j < y.size() && y[j] < value) {
+                    ++j;
+                }
+                found = j < y.size() && y[j] == value;
+            }
+            if (not visit(value, found)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Checks if a sorted array contains all elements of another sorted array (like std::includes).
+    /// @param superset The sorted array to search in.
+    /// @param subset The sorted array of the elements to search.
+    /// @return True if all elements of `subset` are contained in `superset`, false otherwise.
+    template<typename T>
+    auto includes(const std::span<const T> superset, const std::span<const T> subset) -> bool {
+        if (subset.size() > superset.size()) {
+            return false;
+        }
+
+        // short subsets (like the candidates of Apriori) are searched element by element
+        if (subset.size() < block_t<T>::size) {
+            size_t pos = 0;
+            return std::ranges::all_of(subset, [&](const T &value) { return find_next(superset, pos, value); });
+        }
+        return merge_visit(subset, superset, [](const T &, const bool found) { return found; });
+    }
+
+    /// @brief Gets the first position at which two arrays differ.
+    /// @param x The first array.
+    /// @param y The second array.
+    /// @return The first position with different elements or the size of the shorter array.
+    template<typename T>
+    auto mismatch(const std::span<const T> x, const std::span<const T> y) -> size_t {
+        using block = block_t<T>;
+
+        const auto size = std::min(x.size(), y.size());
+        size_t pos = 0;
+
+        for (; pos + block::size <= size; pos += block::size) {
+            if (const auto mask = block::equal_mask(x.data() + pos, y.data() + pos); mask != block::full_mask) {
+                return pos + std::countr_one(mask);
+            }
+        }
+
+        while (pos < size && x[pos] == y[pos]) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    /// @brief Compares two arrays lexicographically, where a longer array precedes its own prefix
+    /// (see fim::lexicographical_compare).
+    /// @param x The first array.
+    /// @param y The second array.
+    /// @return True if `x` precedes `y`, false otherwise.
+    template<typename T>
+    auto lexicographical_compare(const std::span<const T> x, const std::span<const T> y) -> bool {
+        const auto pos = mismatch(x, y);
+        if (pos < x.size() && pos < y.size()) {
+            return x[pos] < y[pos];
+        }
+        return x.size() > y.size();
+    }
+
+    /// @brief Appends the elements of a sorted array that are not contained in another (like std::set_difference).
+    /// @param x The sorted array of the elements.
+    /// @param y The sorted array of the elements to remove.
+    /// @param out The output iterator.
+    /// @return The output iterator behind the last appended element.
+    template<typename T, typename OutputIterator>
+    auto set_difference(const std::span<const T> x, const std::span<const T> y, OutputIterator out)
+        -> OutputIterator {
+        if (x.size() < block_t<T>::size || y.size() < block_t<T>::size) {
+            return std::ranges::set_difference(x, y, out).out;
+        }
+        merge_visit(x, y, [&](const T &value, const bool found) {
+            if (not found) {
+                *out++ = value;
+            }
+            return true;
+        });
+        return out;
+    }
+}
@@ -0,0 +1,311 @@
+/// @file small_vector.h
+/// @brief A vector with inline storage for a small number of elements.
+///
+/// @author Roland Abel
+/// @date October 15, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace fim {
+    /// @brief A vector which stores up to N elements inline and only spills to the heap for larger sizes.
+    /// The elements must be trivially copyable, so that growing and copying is a plain memory copy.
+    /// @tparam T The element type.
+    /// @tparam N The number of elements stored inline.
+    template<typename T, std::size_t N>
+    class small_vector {
+        static_assert(std::is_trivially_copyable_v<T>, "small_vector requires trivially copyable elements");
+        static_assert(N > 0, "small_vector requires an inline capacity greater than zero");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T &;
+        using const_reference = const T &;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using iterator = T *;
+        using const_iterator = const T *;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        small_vector() noexcept = default;
+
+        /// @brief Constructs the vector with count copies of the given value.
+        /// @param count The number of elements.
+        /// @param value The value of the elements.
+        explicit small_vector(const size_type count, const T &value = T{}) {
+            resize(count, value);
+        }
+
+        /// @brief Constructs the vector from a list of elements.
+        /// @param values The list of elements.
+        small_vector(std::initializer_list<T> values) {
+            append(values.begin(), values.size());
+        }
+
+        /// @brief Constructs the vector from the elements of the range [first, last).
+        /// @param first The beginning of the range.
+        /// @param last The end of the range.
+        template<std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        small_vector(Iterator first, Sentinel last) {
+            insert(end(), first, last);
+        }
+
+        small_vector(const small_vector &other) {
+            append(other.data(), other.size());
+        }
+
+        small_vector(small_vector &&other) noexcept {
+            steal(other);
+        }
+
+        auto operator=(const small_vector &other) -> small_vector & {
+            if (this != &other) {
+                size_ = 0;
+                append(other.data(), other.size());
+            }
+            return *this;
+        }
+
+        auto operator=(small_vector &&other) noexcept -> small_vector & {
+            if (this != &other) {
+                release();
+                steal(other);
+            }
+            return *this;
+        }
+
+        auto operator=(std::initializer_list<T> values) -> small_vector & {
+            size_ = 0;
+            append(values.begin(), values.size());
+            return *this;
+        }
+
+        ~small_vector() {
+            release();
+        }
+
+        [[nodiscard]] auto data() noexcept -> pointer { return is_inline() ? inline_ : heap_; }
+        [[nodiscard]] auto data() const noexcept -> const_pointer { return is_inline() ? inline_ : heap_; }
+
+        [[nodiscard]] auto begin() noexcept -> iterator { return data(); }
+        [[nodiscard]] auto begin() const noexcept -> const_iterator { return data(); }
+        [[nodiscard]] auto end() noexcept -> iterator { return data() + size_; }
+        [[nodiscard]] auto end() const noexcept -> const_iterator { return data() + size_; }
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+        [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); }
+        [[nodiscard]] auto rbegin() noexcept -> reverse_iterator { return reverse_iterator{end()}; }
+        [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+        [[nodiscard]] auto rend() noexcept -> reverse_iterator { return reverse_iterator{begin()}; }
+        [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+
+        [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+        [[nodiscard]] auto capacity() const noexcept -> size_type { return capacity_; }
+        [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+        [[nodiscard]] static constexpr auto max_size() noexcept -> size_type {
+            return std::numeric_limits<std::uint32_t>::max();
+        }
+
+        /// @brief Checks if the elements are stored inline, i.e. without heap allocation.
+        /// @return True if the elements are stored inline, false otherwise.
+        [[nodiscard]] auto is_inline() const noexcept -> bool { return capacity_ == N; }
+
+        [[nodiscard]] auto operator[](const size_type pos) noexcept -> reference { return data()[pos]; }
+        [[nodiscard]] auto operator[](const size_type pos) const noexcept -> const_reference { return data()[pos]; }
+
+        [[nodiscard]] auto at(const size_type pos) -> reference {
+            if (pos >= size_) {
+                throw std::out_of_range("small_vector::at");
+            }
+            return data()[pos];
+        }
+
+        [[nodiscard]] auto at(const size_type pos) const -> const_reference {
+            if (pos >= size_) {
+                throw std::out_of_range("small_vector::at");
+            }
+            return data()[pos];
+        }
+
+        [[nodiscard]] auto front() noexcept -> reference { return data()[0]; }
+        [[nodiscard]] auto front() const noexcept -> const_reference { return data()[0]; }
+        [[nodiscard]] auto back() noexcept -> reference { return data()[size_ - 1]; }
+        [[nodiscard]] auto back() const noexcept -> const_reference { return data()[size_ - 1]; }
+
+        auto reserve(const size_type new_capacity) -> void {
+            if (new_capacity > capacity_) {
+                grow(new_capacity);
+            }
+        }
+
+        auto clear() noexcept -> void {
+            size_ = 0;
+        }
+
+        auto resize(const size_type count, const T &value = T{}) -> void {
+            reserve(count);
+            std::uninitialized_fill(data() + std::min<size_type>(size_, count), data() + count, value);
+            size_ = static_cast<std::uint32_t>(count);
+        }
+
+        auto push_back(const T &value) -> void {
+            emplace_back(value);
+        }
+
+        template<typename... Args>
+        auto emplace_back(Args &&... args) -> reference {
+            if (size_ == capacity_) {
+                // the arguments may refer to an element of this vector
+                const T value(std::forward<Args>(args)...);
+                grow(2 * capacity_);
+                return *std::construct_at(data() + size_++, value);
+            }
+            return *std::construct_at(data() + size_++, std::forward<Args>(args)...);
+        }
+
+        auto pop_back() noexcept -> void {
+            --size_;
+        }
+
+        auto insert(const const_iterator pos, const T &value) -> iterator {
+            const T copy = value;
+            return insert(pos, &copy, &copy + 1);
+        }
+
+        template<std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        auto insert(const const_iterator pos, Iterator first, Sentinel last) -> iterator {
+            const auto offset = static_cast<size_type>(pos - begin());
+
+            if constexpr (std::sized_sentinel_for<Sentinel, Iterator> && std::forward_iterator<Iterator>) {
+                const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+                ensure_capacity(size_ + count);
+
+                const auto it = data() + offset;
+                std::copy_backward(it, data() + size_, data() + size_ + count);
+                std::ranges::copy(first, last, it);
+                size_ += static_cast<std::uint32_t>(count);
+            } else {
+                const auto old_size = size_;
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+                std::rotate(data() + offset, data() + old_size, end());
+            }
+            return data() + offset;
+        }
+
+        auto erase(const const_iterator pos) -> iterator {
+            return erase(pos, pos + 1);
+        }
+
+        auto erase(const const_iterator first, const const_iterator last) -> iterator {
+            const auto it = begin() + (first - begin());
+            std::copy(last, cend(), it);
+            size_ -= static_cast<std::uint32_t>(last - first);
+            return it;
+        }
+
+        friend auto operator==(const small_vector &x, const small_vector &y) -> bool {
+            return std::ranges::equal(x, y);
+        }
+
+        friend auto operator<=>(const small_vector &x, const small_vector &y) {
+            return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end());
+        }
+
+        /// @brief Erases all elements that satisfy the predicate.
+        /// @param vector The vector to erase the elements from.
+        /// @param pred The predicate of the elements to be erased.
+        /// @return The number of erased elements.
+        template<typename Predicate>
+        friend auto erase_if(small_vector &vector, Predicate pred) -> size_type {
+            const auto it = std::remove_if(vector.begin(), vector.end(), pred);
+            const auto count = static_cast<size_type>(vector.end() - it);
+            vector.erase(it, vector.end());
+            return count;
+        }
+
+    private:
+        auto ensure_capacity(const size_type required) -> void {
+            if (required > capacity_) {
+                grow(std::max<size_type>(required, 2 * capacity_));
+            }
+        }
+
+        auto append(const T *values, const size_type count) -> void {
+            ensure_capacity(size_ + count);
+            std::copy_n(values, count, data() + size_);
+            size_ += static_cast<std::uint32_t>(count);
+        }
+
+        auto grow(const size_type new_capacity) -> void {
+            auto *heap = std::allocator<T>{}.allocate(new_capacity);
+            std::copy_n(data(), size_, heap);
+
+            release();
+            heap_ = heap;
+            capacity_ = static_cast<std::uint32_t>(new_capacity);
+        }
+
+        auto release() noexcept -> void {
+            if (not is_inline()) {
+                std::allocator<T>{}.deallocate(heap_, capacity_);
+                capacity_ = N;
+            }
+        }
+
+        auto steal(small_vector &other) noexcept -> void {
+            if (other.is_inline()) {
+                std::copy_n(other.inline_, other.size_, inline_);
+            } else {
+                heap_ = other.heap_;
+                capacity_ = other.capacity_;
+                other.capacity_ = N;
+            }
+            size_ = other.size_;
+            other.size_ = 0;
+        }
+
+        std::uint32_t size_{0}; ///< The number of elements.
+        std::uint32_t capacity_{N}; ///< The capacity; equal to N while the elements are stored inline.
+
+        union {
+            T inline_[N]; ///< The inline storage.
+            T *heap_; ///< The heap storage, used if the capacity exceeds N.
+        };
+    };
+}
@@ -31,6 +31,7 @@
 #include <expected>
 #include <item_counts.h>
 #include "data.h"
+#include "itemset_trie.h"
 
 namespace fim::data {
     /// Configuration for writing of csv data
@@ -66,4 +67,16 @@ namespace fim::data {
         const std::string_view &file_path,
         const write_input_t &input,
         const write_csv_config_t &config = write_csv_config_t{}) -> write_result_t;
+
+    /// @brief Writes the itemsets of a trie to a CSV format, without converting them into a flat collection.
+    /// @param os The output stream where the CSV data will be written.
+    /// @param trie The trie of the frequent itemsets and their support counts.
+    /// @param num_transactions The number of transactions, by which the support counts are divided.
+    /// @param config Configuration settings that control the CSV writing behavior (optional).
+    /// @return The result of the writing operation, indicating success or failure.
+    auto to_csv(
+        std::ostream &os,
+        const itemset_trie_t &trie,
+        size_t num_transactions,
+        const write_csv_config_t &config = write_csv_config_t{}) -> write_result_t;
 }
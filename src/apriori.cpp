@@ -28,7 +28,15 @@
 
 #include <ranges>
 #include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <variant>
 #include "item_counts.h"
+#include "bit_database.h"
 #include "apriori.h"
 
 namespace fim::algorithm::apriori {
@@ -51,96 +59,456 @@ namespace fim::algorithm::apriori {
                | to<itemsets_t>();
     }
 
-    auto generate_candidates(
-        const itemsets_t &frequent_itemsets,
-        const size_t k,
-        const item_compare_t &compare) -> itemsets_t {
-        auto merge_itemsets_if_equal_prefix = [&](const itemset_t &x, const itemset_t &y) -> std::optional<itemset_t> {
-            if (std::ranges::equal(x | std::views::take(k - 2), y | std::views::take(k - 2))) {
-                itemset_t candidate{};
-                copy(x | std::views::take(k - 1), std::back_inserter(candidate));
-                candidate.push_back(y[k - 2]);
-                candidate.sort_itemset(compare);
-
-                return candidate;
-            }
-            return std::nullopt;
+    template<typename Compare>
+    candidate_trie_t::candidate_trie_t(const itemsets_t &candidates, const Compare &compare) {
+        if (candidates.empty()) {
+            return;
+        }
+
+        // the candidates are inserted in lexicographical order, which Apriori creates them in
+        std::vector<size_t> order(candidates.size());
+        std::iota(order.begin(), order.end(), 0);
+
+        const auto less = [&](const size_t x, const size_t y) {
+            return lexicographical_compare(candidates[x], candidates[y], compare);
         };
+        if (not std::ranges::is_sorted(order, less)) {
+            std::ranges::sort(order, less);
+        }
+
+        const auto k = candidates.front().size();
+        items.resize(k);
+        children.resize(k - 1);
+        leaves.resize(candidates.size());
+
+        const itemset_t *previous = nullptr;
+        for (const auto index: order) {
+            const auto &candidate = candidates[index];
+            assert(candidate.size() == k);
+
+            // the nodes of the prefix shared with the previous candidate exist already
+            size_t depth = 0;
+            while (previous != nullptr && depth < k && (*previous)[depth] == candidate[depth]) {
+                ++depth;
+            }
+
+            for (; depth < k; ++depth) {
+                items[depth].push_back(candidate[depth]);
+                if (depth + 1 < k) {
+                    children[depth].push_back(items[depth + 1].size());
+                }
+            }
+            leaves[index] = items[k - 1].size() - 1;
+            previous = &candidate;
+        }
 
-        // Combine pairs of frequent frequent_itemsets
-        auto create_candidates = [&]() -> itemsets_t {
-            itemsets_t candidates{};
-            for (auto x = frequent_itemsets.begin(); x != frequent_itemsets.end(); ++x) {
-                for (auto y = std::next(x); y != frequent_itemsets.end(); ++y) {
-                    if (auto matched = merge_itemsets_if_equal_prefix(*x, *y); matched) {
-                        candidates.emplace_back(std::move(*matched));
+        for (size_t depth = 0; depth + 1 < k; ++depth) {
+            children[depth].push_back(items[depth + 1].size());
+        }
+    }
+
+    namespace {
+        // Merges the transaction behind the given position with the nodes [begin, end) of the given depth and
+        // continues with the children of each matched node; the counts of the matched leaves are increased.
+        // Returns the number of matched leaves, which are added to the hits of the matched positions (if given).
+        template<typename Compare>
+        auto count_transaction(
+            const candidate_trie_t &trie,
+            const transaction_t &transaction,
+            const size_t depth,
+            size_t begin,
+            const size_t end,
+            size_t pos,
+            const size_t weight,
+            const Compare &compare,
+            counts_t &counts,
+            size_t *hits) -> size_t {
+            const auto &items = trie.items[depth];
+            const auto is_leaf = depth + 1 == trie.depth();
+            size_t num_matches = 0;
+
+            // the items behind the position must suffice for the remaining depths
+            const auto last = transaction.size() + depth + 1 - trie.depth();
+            while (begin < end && pos < last) {
+                if (compare(items[begin], transaction[pos])) {
+                    ++begin;
+                } else if (compare(transaction[pos], items[begin])) {
+                    ++pos;
+                } else {
+                    size_t matches = 1;
+                    if (is_leaf) {
+                        counts[begin] += weight;
+                    } else {
+                        matches = count_transaction(trie, transaction, depth + 1, trie.children[depth][begin],
+                                                    trie.children[depth][begin + 1], pos + 1, weight, compare,
+                                                    counts, hits);
+                    }
+                    if (hits != nullptr) {
+                        hits[pos] += matches;
+                    }
+                    num_matches += matches;
+                    ++begin;
+                    ++pos;
+                }
+            }
+            return num_matches;
+        }
+
+        // Counts the candidates of the trie in each transaction and appends the trimmed transactions to the given
+        // database (if given).
+        template<typename Compare>
+        auto count_candidates(
+            const candidate_trie_t &trie,
+            const database_t &database,
+            const Compare &compare,
+            database_t *trimmed) -> counts_t {
+            const auto k = trie.depth();
+            std::vector<size_t> hits{};
+            std::vector<item_t> kept{};
+
+            counts_t leaf_counts(trie.items.back().size(), 0);
+            for (size_t i = 0; i < database.size(); ++i) {
+                const auto transaction = database[i];
+                if (transaction.size() < k) {
+                    continue;
+                }
+
+                const auto weight = database.get_weight(i);
+                if (trimmed == nullptr) {
+                    count_transaction(trie, transaction, 0, 0, trie.items.front().size(), 0, weight, compare,
+                                      leaf_counts, nullptr);
+                    continue;
+                }
+
+                hits.assign(transaction.size(), 0);
+                if (count_transaction(trie, transaction, 0, 0, trie.items.front().size(), 0, weight, compare,
+                                      leaf_counts, hits.data()) <= k) {
+                    continue;
+                }
+
+                kept.clear();
+                for (size_t pos = 0; pos < transaction.size(); ++pos) {
+                    if (hits[pos] >= k) {
+                        kept.push_back(transaction[pos]);
+                    }
+                }
+                if (kept.size() > k) {
+                    trimmed->push_back(transaction_t{kept}, weight);
+                }
+            }
+
+            counts_t supports(trie.leaves.size());
+            for (size_t i = 0; i < trie.leaves.size(); ++i) {
+                supports[i] = leaf_counts[trie.leaves[i]];
+            }
+            return supports;
+        }
+    }
+
+    template<typename Compare>
+    auto candidate_trie_t::get_supports(const database_t &database, const Compare &compare) const -> counts_t {
+        return leaves.empty() ? counts_t{} : count_candidates(*this, database, compare, nullptr);
+    }
+
+    template<typename Compare>
+    auto candidate_trie_t::get_supports(const database_t &database, const Compare &compare, database_t &trimmed) const
+        -> counts_t {
+        trimmed.clear();
+        return leaves.empty() ? counts_t{} : count_candidates(*this, database, compare, &trimmed);
+    }
+
+    template candidate_trie_t::candidate_trie_t(const itemsets_t &, const item_compare_t &);
+    template candidate_trie_t::candidate_trie_t(const itemsets_t &, const rank_compare_t &);
+    template auto candidate_trie_t::get_supports(const database_t &, const item_compare_t &) const -> counts_t;
+    template auto candidate_trie_t::get_supports(const database_t &, const rank_compare_t &) const -> counts_t;
+    template auto candidate_trie_t::get_supports(const database_t &, const item_compare_t &, database_t &) const
+        -> counts_t;
+    template auto candidate_trie_t::get_supports(const database_t &, const rank_compare_t &, database_t &) const
+        -> counts_t;
+
+    namespace {
+        // A hash set of the itemsets of a level, which looks up the subsets of a candidate that leave out one of
+        // its items without creating them: The hash of an itemset is the sum of the hashes of its items, so the
+        // hash of such a subset is the one of the candidate minus the one of the left out item.
+        struct level_index_t {
+            const itemsets_t &level;
+            std::vector<std::uint64_t> slots{}; ///< The upper hash bits and the index + 1 of an itemset; 0 if empty.
+
+            explicit level_index_t(const itemsets_t &level) : level(level) {
+                slots.assign(std::bit_ceil(2 * level.size() + 1), 0);
+
+                for (size_t index = 0; index < level.size(); ++index) {
+                    std::uint64_t hash = 0;
+                    for (const auto &item: level[index]) {
+                        hash += hash_item(item);
+                    }
+
+                    auto pos = hash & (slots.size() - 1);
+                    while (slots[pos] != 0) {
+                        pos = (pos + 1) & (slots.size() - 1);
+                    }
+                    slots[pos] = (hash & 0xffffffff00000000) | (index + 1);
+                }
+            }
+
+            // The SplitMix64 mixer, so that the sums of the hashes of different itemsets rarely collide.
+            static auto hash_item(const item_t item) -> std::uint64_t {
+                std::uint64_t hash = static_cast<std::uint64_t>(item) + 0x9e3779b97f4a7c15;
+                hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+                hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+                return hash ^ (hash >> 31);
+            }
+
+            // Checks if the level contains the candidate without the item at the given position.
+            [[nodiscard]] auto contains(const itemset_t &candidate, const size_t skip, const std::uint64_t hash) const
+                -> bool {
+                const auto is_subset = [&](const itemset_t &itemset) {
+                    return std::equal(candidate.begin(), candidate.begin() + static_cast<std::ptrdiff_t>(skip),
+                                      itemset.begin())
+                           && std::equal(candidate.begin() + static_cast<std::ptrdiff_t>(skip + 1), candidate.end(),
+                                         itemset.begin() + static_cast<std::ptrdiff_t>(skip));
+                };
+
+                for (auto pos = hash & (slots.size() - 1);; pos = (pos + 1) & (slots.size() - 1)) {
+                    const auto slot = slots[pos];
+                    if (slot == 0) {
+                        return false;
+                    }
+                    if ((slot ^ hash) >> 32 == 0 && is_subset(level[(slot & 0xffffffff) - 1])) {
+                        return true;
                     }
                 }
             }
-            return candidates;
         };
 
-        auto all_subsets_frequent = [&](const itemset_t &candidate) -> bool {
-            auto is_frequent = [&](const itemset_t &itemset) {
-                return std::ranges::contains(frequent_itemsets, itemset);
+        template<typename Compare>
+        auto generate_candidates_(
+            const itemsets_t &frequent_itemsets,
+            const size_t k,
+            const Compare &compare) -> itemsets_t {
+            // The itemsets sharing a (k-2)-prefix are contiguous in lexicographical order, so only the itemsets of
+            // each such block are joined. The items of x precede the last item of any following y of its block,
+            // so the candidates are sorted and come in lexicographical order, i.e. the next level is sorted, too.
+            const auto join_blocks = [&](const itemsets_t &level) -> itemsets_t {
+                const level_index_t index{level};
+
+                // The subsets leaving out one of the last two items of a candidate are the joined itemsets,
+                // so only the ones leaving out one of the others are looked up.
+                const auto all_subsets_frequent = [&](const itemset_t &candidate) -> bool {
+                    std::uint64_t hash = 0;
+                    for (const auto &item: candidate) {
+                        hash += level_index_t::hash_item(item);
+                    }
+
+                    for (size_t i = 0; i + 2 < candidate.size(); ++i) {
+                        if (not index.contains(candidate, i, hash - level_index_t::hash_item(candidate[i]))) {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+
+                const auto has_prefix = [&](const itemset_t &x, const itemset_t &y) {
+                    return std::equal(x.begin(), x.begin() + static_cast<std::ptrdiff_t>(k - 2), y.begin());
+                };
+
+                itemsets_t candidates{};
+                for (size_t begin = 0, end = 0; begin < level.size(); begin = end) {
+                    end = begin + 1;
+                    while (end < level.size() && has_prefix(level[begin], level[end])) {
+                        ++end;
+                    }
+
+                    for (auto x = begin; x < end; ++x) {
+                        for (auto y = x + 1; y < end; ++y) {
+                            itemset_t candidate{level[x]};
+                            candidate.push_back(level[y][k - 2]);
+
+                            if (all_subsets_frequent(candidate)) {
+                                candidates.emplace_back(std::move(candidate));
+                            }
+                        }
+                    }
+                }
+                return candidates;
             };
 
-            auto create_subset = [&](const item_t &item) {
-                return candidate
-                       | filter([&](const item_t &i) { return i != item; })
-                       | to<itemset_t>();
+            // the levels found by the algorithm are sorted, only others (e.g. the one-itemsets) need to be sorted
+            const auto less = [&](const itemset_t &x, const itemset_t &y) {
+                return lexicographical_compare(x, y, compare);
             };
 
-            return std::ranges::all_of(candidate | transform(create_subset), is_frequent);
-        };
+            if (std::ranges::is_sorted(frequent_itemsets, less)) {
+                return join_blocks(frequent_itemsets);
+            }
 
-        return create_candidates()
-               | filter(all_subsets_frequent)
-               | to<itemsets_t>();
+            auto sorted_itemsets = frequent_itemsets;
+            sort(sorted_itemsets, less);
+            return join_blocks(sorted_itemsets);
+        }
+
+        // Counts the supports of the candidates: In dense databases of few ranks, i.e. the transactions contain at
+        // least a quarter of the ranks on average, the transactions are matched as bitsets against each candidate.
+        // All others are walked through the candidate trie, whose cost does not grow with the number of candidates;
+        // this walk trims the transactions for the next level, too (if a database for them is given).
+        template<typename Compare>
+        auto get_supports(
+            const itemsets_t &candidates,
+            const database_t &database,
+            const Compare &compare,
+            std::optional<database_t> *trimmed) -> counts_t {
+            const auto count_in_trie = [&]() -> counts_t {
+                const candidate_trie_t trie{candidates, compare};
+                if (trimmed == nullptr) {
+                    return trie.get_supports(database, compare);
+                }
+                return trie.get_supports(database, compare, trimmed->emplace());
+            };
+
+            if constexpr (std::is_same_v<Compare, rank_compare_t>) {
+                const auto num_ranks = database.items.empty() ? size_t{0} : std::ranges::max(database.items) + 1;
+                if (4 * database.items.size() < database.size() * num_ranks) {
+                    return count_in_trie();
+                }
+
+                return std::visit([&]<typename Matrix>(const Matrix &matrix) -> counts_t {
+                    if constexpr (std::is_same_v<Matrix, std::monostate>) {
+                        return count_in_trie();
+                    } else {
+                        return matrix.get_supports(candidates);
+                    }
+                }, create_bit_matrix(database));
+            } else {
+                return count_in_trie();
+            }
+        }
+
+        // Removes the candidates below the minimum support and returns the supports of the remaining ones.
+        template<typename Compare>
+        auto prune_(
+            itemsets_t &candidates,
+            const database_t &database,
+            size_t min_support,
+            const Compare &compare,
+            std::optional<database_t> *trimmed = nullptr) -> counts_t {
+            auto supports = get_supports(candidates, database, compare, trimmed);
+
+            size_t num_frequent = 0;
+            for (size_t i = 0; i < candidates.size(); ++i) {
+                if (supports[i] >= min_support) {
+                    supports[num_frequent] = supports[i];
+                    candidates[num_frequent++] = std::move(candidates[i]);
+                }
+            }
+            candidates.resize(num_frequent);
+            supports.resize(num_frequent);
+
+            return supports;
+        }
+
+        template<typename Compare>
+        auto apriori_(
+            const database_t &db,
+            const item_counts_t &item_counts,
+            size_t min_support,
+            const Compare &compare,
+            const itemset_sink_t &sink) -> void {
+            // Find all 1-element suffixes
+            auto itemsets = all_frequent_one_itemsets(item_counts, min_support);
+            for (const auto &itemset: itemsets) {
+                sink(itemset, item_counts.at(itemset.front()));
+            }
+
+            // The pairs of all ranks up to the greatest frequent one are counted in a triangular array in one pass;
+            // the frequent pairs come in lexicographical order, like the generated candidates.
+            auto k = 2;
+            if constexpr (std::is_same_v<Compare, rank_compare_t>) {
+                const auto num_ranks = pair_counts_t::get_num_ranks(item_counts, min_support);
+                if (num_ranks >= 2 && pair_counts_t::fits(num_ranks)) {
+                    const auto [pairs, supports] = pair_counts_t{db, num_ranks}.get_frequent_pairs(min_support);
+                    for (size_t i = 0; i < pairs.size(); ++i) {
+                        sink(pairs[i], supports[i]);
+                    }
+                    itemsets = pairs;
+                    k = 3;
+                }
+            }
+
+            // The working database shrinks from level to level: Each count in the candidate trie keeps only the
+            // transactions and items, which may still be part of a candidate of the next level.
+            std::optional<database_t> working{};
+            for (; !itemsets.empty(); k++) {
+                // Create k-itemset from the previous (k-1)-suffix
+                itemsets = generate_candidates_(itemsets, k, compare);
+
+                // Remove all itemset with low support
+                std::optional<database_t> trimmed{};
+                const auto supports = prune_(itemsets, working ? *working : db, min_support, compare, &trimmed);
+                if (trimmed) {
+                    working = std::move(trimmed);
+                }
+
+                // Pass on the frequent candidates
+                for (size_t i = 0; i < itemsets.size(); ++i) {
+                    sink(itemsets[i], supports[i]);
+                }
+            }
+        }
+    }
+
+    auto generate_candidates(
+        const itemsets_t &frequent_itemsets,
+        const size_t k,
+        const item_compare_t &compare) -> itemsets_t {
+        return generate_candidates_(frequent_itemsets, k, compare);
+    }
+
+    auto generate_candidates(
+        const itemsets_t &frequent_itemsets,
+        const size_t k,
+        const rank_compare_t &compare) -> itemsets_t {
+        return generate_candidates_(frequent_itemsets, k, compare);
     }
 
     auto prune(
         itemsets_t &candidates,
         const database_t &database,
-        size_t min_support,
+        const size_t min_support,
         const item_compare_t &compare) -> void {
-        const auto &counts = itemset_counts_t::create_itemset_counts(database, candidates, compare);
-        const auto is_infrequent = [&](const itemset_t &z) -> bool {
-            return !counts.contains(z) || counts.at(z) < min_support;
-        };
+        prune_(candidates, database, min_support, compare);
+    }
 
-        std::erase_if(candidates, is_infrequent);
+    auto prune(
+        itemsets_t &candidates,
+        const database_t &database,
+        const size_t min_support,
+        const rank_compare_t &compare) -> void {
+        prune_(candidates, database, min_support, compare);
     }
 
     auto apriori_algorithm(const database_t &database, const size_t min_support) -> itemsets_t {
-        const auto [db, item_counts] = database.transaction_reduction(min_support);
-        return apriori_algorithm_({db, item_counts}, min_support);
+        itemsets_t freq_itemsets{};
+        apriori_algorithm(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
     }
 
-    auto apriori_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t {
+    auto apriori_algorithm_(const database_view_t &database, const size_t min_support) -> itemsets_t {
         itemsets_t freq_itemsets{};
+        apriori_algorithm_(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
+    }
 
-        const auto &[db, item_counts] = database;
-        const auto compare = item_counts.get_item_compare();
-
-        auto insert_itemset = [&](const auto &itemsets) {
-            copy(itemsets, std::back_inserter(freq_itemsets));
-        };
-
-        // Find all 1-element suffixes
-        auto itemsets = all_frequent_one_itemsets(item_counts, min_support);
-        insert_itemset(itemsets);
-
-        for (auto k = 2; !itemsets.empty(); k++) {
-            // Create k-itemset from the previous (k-1)-suffix
-            itemsets = generate_candidates(itemsets, k, compare);
-
-            // Remove all itemset with low support
-            prune(itemsets, db, min_support, compare);
+    auto apriori_algorithm(const database_t &database, const size_t min_support, const itemset_sink_t &sink) -> void {
+        const auto [db, item_counts, item_ranks] = database.rank_reduction(
+            min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
+        apriori_algorithm_({db, item_counts}, min_support, item_ranks.to_items(sink));
+    }
 
-            // Insert frequent candidates
-            insert_itemset(itemsets);
-        }
-        return freq_itemsets;
+    auto apriori_algorithm_(const database_view_t &database, const size_t min_support, const itemset_sink_t &sink)
+        -> void {
+        const auto &[db, item_counts] = database;
+        item_counts.visit_item_compare([&](const auto &compare) {
+            apriori_(db, item_counts, min_support, compare, sink);
+        });
     }
 }
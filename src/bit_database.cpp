@@ -0,0 +1,103 @@
+/// @file bit_database.cpp
+/// @brief Implementation of the bit matrix representation of databases.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <algorithm>
+#include "bit_database.h"
+
+namespace fim {
+    template<size_t NumWords>
+    bit_database_t<NumWords>::bit_database_t(const database_t &database)
+        : weights(database.weights) {
+        rows.reserve(database.size());
+        for (const auto &transaction: database) {
+            rows.push_back(to_bitset(transaction));
+        }
+    }
+
+    template<size_t NumWords>
+    auto bit_database_t<NumWords>::to_bitset(const transaction_t &itemset) -> bitset_t<NumWords> {
+        bitset_t<NumWords> bits{};
+        for (const auto &item: itemset) {
+            bits[item / 64] |= std::uint64_t{1} << (item % 64);
+        }
+        return bits;
+    }
+
+    template<size_t NumWords>
+    auto bit_database_t<NumWords>::get_support(const transaction_t &itemset) const -> size_t {
+        // no transaction contains a rank that does not fit into the bitsets
+        if (std::ranges::any_of(itemset, [](const item_t &item) { return item >= max_items; })) {
+            return 0;
+        }
+
+        const auto bits = to_bitset(itemset);
+        size_t support = 0;
+
+        if (weights.empty()) {
+            for (const auto &row: rows) {
+                support += is_subset(bits, row);
+            }
+            return support;
+        }
+
+        for (size_t i = 0; i < rows.size(); ++i) {
+            support += is_subset(bits, rows[i]) ? weights[i] : 0;
+        }
+        return support;
+    }
+
+    template<size_t NumWords>
+    auto bit_database_t<NumWords>::get_supports(const itemsets_t &itemsets) const -> counts_t {
+        counts_t supports{};
+        supports.reserve(itemsets.size());
+
+        for (const auto &itemset: itemsets) {
+            supports.push_back(get_support(itemset));
+        }
+        return supports;
+    }
+
+    template struct bit_database_t<1>;
+    template struct bit_database_t<2>;
+    template struct bit_database_t<4>;
+
+    auto create_bit_matrix(const database_t &database) -> bit_matrix_t {
+        const auto num_items = database.items.empty() ? size_t{0} : std::ranges::max(database.items) + 1;
+
+        if (num_items <= bit_database_t<1>::max_items) {
+            return bit_database_t<1>{database};
+        }
+        if (num_items <= bit_database_t<2>::max_items) {
+            return bit_database_t<2>{database};
+        }
+        if (num_items <= bit_database_t<4>::max_items) {
+            return bit_database_t<4>{database};
+        }
+        return std::monostate{};
+    }
+}
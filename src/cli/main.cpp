@@ -33,6 +33,7 @@
 #include <optional>
 #include "CLI/CLI.hpp"
 #include "algorithms.h"
+#include "huge_page_resource.h"
 #include "reader.h"
 #include "writer.h"
 
@@ -46,6 +47,7 @@ struct configuration_t {
     float min_support;
     algorithm_t algorithm;
     bool override;
+    bool huge_pages;
 };
 
 void add_options(CLI::App &app, configuration_t &config) {
@@ -68,6 +70,9 @@ void add_options(CLI::App &app, configuration_t &config) {
     app.add_flag("--override", config.override)
             ->description("If set, the output file is overwritten if it already exists");
 
+    app.add_flag("--huge-pages", config.huge_pages)
+            ->description("If set, the data structures of the algorithm are allocated from transparent huge pages");
+
     app.add_option("-i, --input", config.input_path)
             ->description("Path to the input file containing the database")
             ->required()
@@ -117,51 +122,61 @@ auto main(const int argc, char **argv) -> int {
                 return std::nullopt;
             }
 
-            const auto &db = *res;
-            return std::tuple{db, db.size()};
+            auto db = std::move(*res);
+            const auto db_size = db.size();
+            return std::tuple{std::move(db), db_size};
         };
 
-        auto prepare_database = [&config](const auto &input) {
-            const auto &[database, db_size] = input;
+        auto prepare_database = [&config](auto &&input) {
+            auto &[database, db_size] = input;
 
+            // the database is reduced and ranked in place
             const auto min_support = static_cast<size_t>(config.min_support * static_cast<float>(db_size));
-            const auto &[db, item_counts] = database.transaction_reduction(min_support);
-            const auto compare = item_counts.get_item_compare();
+            auto [db, item_counts, item_ranks] = std::move(database).rank_reduction(
+                min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
 
-            return std::optional{std::tuple{db, item_counts, min_support, db_size}};
+            return std::optional{
+                std::tuple{std::move(db), std::move(item_counts), std::move(item_ranks), min_support, db_size}
+            };
         };
 
-        auto apply_algorithm = [&config](const auto &input) {
-            const auto &[db, item_counts, min_support, db_size] = input;
-            auto freq_items = get_algorithm(config.algorithm)({db, item_counts}, min_support)
-                    .sort_each_itemset(item_counts.get_item_compare());
+        auto apply_algorithm = [&config](auto &&input) {
+            auto &[db, item_counts, item_ranks, min_support, db_size] = input;
 
-            return std::optional{std::tuple{db, freq_items, item_counts, db_size}};
-        };
+            huge_page_resource_t huge_page_resource{};
+            const auto resource = config.huge_pages
+                                      ? static_cast<std::pmr::memory_resource *>(&huge_page_resource)
+                                      : std::pmr::get_default_resource();
 
-        auto count_frequencies = [&](const auto &input) {
-            const auto &[db, freq_items, item_counts, db_size] = input;
-            const auto &counts = itemset_counts_t::create_itemset_counts(
-                db,
-                freq_items,
-                item_counts.get_item_compare());
+            // the algorithms report the support of each itemset, so the database need not be scanned again
+            auto [freq_items, counts] = get_counting_algorithm(config.algorithm, resource)(
+                {db, item_counts}, min_support);
+            freq_items.sort_each_itemset(item_counts.get_item_compare());
+
+            if (config.huge_pages) {
+                std::cout << "Huge pages        : " << huge_page_resource.huge_pages() << " of "
+                        << huge_page_resource.mapped_bytes() / huge_page_resource_t::huge_page_size << " mapped"
+                        << (huge_page_resource.huge_pages_advised() ? "" : " (transparent huge pages unavailable)")
+                        << std::endl;
+            }
 
-            return std::optional{std::tuple{freq_items, counts, db_size}};
+            return std::optional{
+                std::tuple{std::move(freq_items), std::move(counts), std::move(item_ranks), db_size}
+            };
         };
 
         auto get_support_values = [&](const auto &input) {
-            const auto &[freq_items, counts, db_size] = input;
-
-            auto get_support = [&](const auto &itemset) -> float {
-                return counts.get_support(itemset, db_size);
-            };
+            const auto &[freq_items, counts, item_ranks, db_size] = input;
 
             support_values_t support_values{};
-            for (const auto &itemset: freq_items) {
-                support_values.push_back(get_support(itemset));
+            support_values.reserve(counts.size());
+
+            for (const auto &count: counts) {
+                support_values.push_back(static_cast<float>(count) / static_cast<float>(db_size));
             }
 
-            return std::optional{std::tuple{freq_items, support_values}};
+            // maps the ranks back to the original items
+            return std::optional{std::tuple{item_ranks.to_items(freq_items), support_values}};
         };
 
         auto to_csv = [&](const auto &input) {
@@ -177,7 +192,6 @@ auto main(const int argc, char **argv) -> int {
         const auto result = read_csv()
                 .and_then(prepare_database)
                 .and_then(apply_algorithm)
-                .and_then(count_frequencies)
                 .and_then(get_support_values)
                 .transform(to_csv);
 
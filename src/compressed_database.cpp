@@ -0,0 +1,121 @@
+/// @file compressed_database.cpp
+/// @brief Implementation of the prefix-compressed database.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <algorithm>
+#include "compressed_database.h"
+
+namespace fim {
+    namespace {
+        // Appends an unsigned integer as a varint: 7 bits per byte, the highest bit marks a following byte.
+        auto write_varint(std::vector<std::uint8_t> &bytes, std::uint64_t value) -> void {
+            while (value >= 0x80) {
+                bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            bytes.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        // Reads a varint and advances the position behind it.
+        auto read_varint(const std::vector<std::uint8_t> &bytes, size_t &position) -> std::uint64_t {
+            if (bytes[position] < 0x80) [[likely]] {
+                return bytes[position++];
+            }
+
+            std::uint64_t value = bytes[position] & 0x7f;
+            for (unsigned shift = 7; bytes[position++] & 0x80; shift += 7) {
+                value |= static_cast<std::uint64_t>(bytes[position] & 0x7f) << shift;
+            }
+            return value;
+        }
+
+        // Maps the difference of two items to an unsigned integer, small differences of either sign to small ones.
+        auto zigzag_encode(const item_t item, const item_t previous) -> std::uint64_t {
+            const auto difference = static_cast<std::int64_t>(item) - static_cast<std::int64_t>(previous);
+            return (static_cast<std::uint64_t>(difference) << 1) ^ static_cast<std::uint64_t>(difference >> 63);
+        }
+
+        auto zigzag_decode(const std::uint64_t value, const item_t previous) -> item_t {
+            const auto difference = static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+            return static_cast<item_t>(static_cast<std::int64_t>(previous) + difference);
+        }
+    }
+
+    compressed_database_t::compressed_database_t(const database_t &database)
+        : num_transactions(database.size()), num_items(database.items.size()), weighted(database.is_weighted()) {
+        bytes.reserve(database.items.size() + 2 * database.size());
+
+        transaction_t previous{};
+        for (size_t i = 0; i < database.size(); ++i) {
+            const auto transaction = database[i];
+            const auto prefix_size = static_cast<size_t>(
+                std::ranges::mismatch(transaction, previous).in1 - transaction.begin());
+
+            write_varint(bytes, prefix_size);
+            write_varint(bytes, transaction.size() - prefix_size);
+            if (weighted) {
+                write_varint(bytes, database.get_weight(i));
+            }
+
+            auto last = prefix_size > 0 ? transaction[prefix_size - 1] : item_t{0};
+            for (const auto &item: transaction.subspan(prefix_size)) {
+                write_varint(bytes, zigzag_encode(item, last));
+                last = item;
+            }
+            previous = transaction;
+        }
+        bytes.shrink_to_fit();
+    }
+
+    auto compressed_database_t::decoder_t::next() -> bool {
+        if (position == database->bytes.size()) {
+            return false;
+        }
+
+        const auto &bytes = database->bytes;
+        prefix_size = read_varint(bytes, position);
+        const auto suffix_size = read_varint(bytes, position);
+        weight = database->weighted ? read_varint(bytes, position) : 1;
+
+        items.resize(prefix_size + suffix_size);
+        auto last = prefix_size > 0 ? items[prefix_size - 1] : item_t{0};
+        for (auto i = prefix_size; i < items.size(); ++i) {
+            last = zigzag_decode(read_varint(bytes, position), last);
+            items[i] = last;
+        }
+        return true;
+    }
+
+    auto compressed_database_t::to_database() const -> database_t {
+        database_t database{};
+        database.reserve(num_transactions, num_items);
+        for_each_transaction(*this, [&](const transaction_t &transaction, const size_t weight) {
+            database.push_back(transaction, weight);
+        });
+        return database;
+    }
+}
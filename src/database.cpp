@@ -27,58 +27,608 @@
 /// THE SOFTWARE.
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <utility>
 #include "itemset.h"
 #include "database.h"
 #include "item_counts.h"
+#include "parallel.h"
 
 namespace fim {
-    database_t::database_t(itemsets_t itemsets)
-        : std::vector<itemset_t>(std::move(itemsets)) {
+    database_t::database_t(const std::initializer_list<itemset_t> itemsets) {
+        for (const auto &itemset: itemsets) {
+            push_back(itemset);
+        }
+    }
+
+    database_t::database_t(const itemsets_t &itemsets) {
+        for (const auto &itemset: itemsets) {
+            push_back(itemset);
+        }
+    }
+
+    auto database_t::reserve(const size_t num_transactions, const size_t num_items) -> void {
+        offsets.reserve(num_transactions + 1);
+        items.reserve(num_items);
+    }
+
+    auto database_t::clear() -> void {
+        items.clear();
+        offsets.assign(1, 0);
+        weights.clear();
+    }
+
+    auto database_t::get_total_weight() const -> size_t {
+        return is_weighted() ? std::reduce(weights.begin(), weights.end(), size_t{0}) : size();
     }
 
-    auto database_t::sort_lexicographically(const item_compare_t &compare) -> database_t {
-        for (itemset_t &trans: *this) {
-            std::ranges::sort(trans, compare);
+    auto database_t::push_back(const transaction_t &transaction, const size_t weight) -> void {
+        if (weight != 1 && not is_weighted()) {
+            weights.assign(size(), 1);
         }
 
-        std::ranges::sort(*this, [&](const itemset_t &x, const itemset_t &y) {
-            return lexicographical_compare(x, y, compare);
-        });
+        items.insert(items.end(), transaction.begin(), transaction.end());
+        offsets.push_back(items.size());
+
+        if (weight != 1 || is_weighted()) {
+            weights.push_back(weight);
+        }
+    }
+
+    auto database_t::collapse_duplicates() -> void {
+        if (empty()) {
+            return;
+        }
+
+        std::vector<size_t> collapsed_weights{get_weight(0)};
+        collapsed_weights.reserve(size());
+
+        // Compacts the items in place: The first transaction is kept, every following one is either merged
+        // into its predecessor (identical items) or moved behind it.
+        size_t num_items = offsets[1];
+        size_t num_transactions = 1;
+
+        for (size_t i = 1; i < size(); ++i) {
+            const auto trans = (*this)[i];
+            const auto last = transaction_t{items.data() + offsets[num_transactions - 1], items.data() + num_items};
+
+            if (trans == last) {
+                collapsed_weights.back() += get_weight(i);
+                continue;
+            }
+
+            if (offsets[i] != num_items) {
+                std::ranges::copy(trans, items.begin() + static_cast<std::ptrdiff_t>(num_items));
+            }
+            num_items += trans.size();
+            offsets[++num_transactions] = num_items;
+            collapsed_weights.push_back(get_weight(i));
+        }
+
+        items.resize(num_items);
+        offsets.resize(num_transactions + 1);
+        weights = std::move(collapsed_weights);
+    }
+
+    namespace {
+        // Copies the transactions of the database in the given order of their positions.
+        auto permute_transactions(database_t &database, const std::vector<size_t> &order) -> void {
+            database_t sorted{};
+            sorted.reserve(database.size(), database.items.size());
+
+            for (const auto pos: order) {
+                sorted.push_back(database[pos], database.get_weight(pos));
+            }
+            database = std::move(sorted);
+        }
+
+        template<typename Compare>
+        auto sort_lexicographically_(database_t &database, const Compare &compare) -> void {
+            // sorts the items of each transaction in place
+            for (size_t i = 0; i < database.size(); ++i) {
+                std::sort(
+                    database.items.begin() + static_cast<std::ptrdiff_t>(database.offsets[i]),
+                    database.items.begin() + static_cast<std::ptrdiff_t>(database.offsets[i + 1]),
+                    compare);
+            }
+
+            // sorts the transactions by their positions and copies them in this order
+            std::vector<size_t> order(database.size());
+            std::iota(order.begin(), order.end(), 0);
+
+            std::ranges::sort(order, [&](const size_t x, const size_t y) {
+                return lexicographical_compare(database[x], database[y], compare);
+            });
+            permute_transactions(database, order);
+        }
+    }
+
+    auto database_t::sort_lexicographically(const item_compare_t &compare) -> database_t & {
+        sort_lexicographically_(*this, compare);
         return *this;
     }
 
-    auto database_t::get_item_counts() const -> item_counts_t {
+    auto database_t::sort_lexicographically(const rank_compare_t &compare) -> database_t & {
+        sort_lexicographically_(*this, compare);
+        return *this;
+    }
+
+    namespace {
+        // Number of transactions per thread below which no further thread is started.
+        constexpr size_t min_transactions_per_thread = 4096;
+
+        // Number of items per thread below which no further thread is started.
+        constexpr size_t min_items_per_thread = 1 << 16;
+
+        // Number of items of the largest dense universe, so that an array of counters takes at most 8 MiB.
+        constexpr size_t max_dense_universe = size_t{1} << 20;
+
+        // Gets the number of items of a dense item universe [0, n), i.e. one small enough for arrays indexed by
+        // the items. The universe is bounded by the number of items (or a small constant for tiny databases) and
+        // by a fixed cap. The largest item is compared, as its successor may not be representable.
+        auto get_dense_universe(const database_t &database) -> std::optional<size_t> {
+            if (database.items.empty()) {
+                return size_t{0};
+            }
+
+            const auto max_item = static_cast<size_t>(std::ranges::max(database.items));
+            const auto limit = std::min(max_dense_universe, std::max<size_t>(database.items.size(), 1 << 16));
+            return max_item < limit ? std::optional{max_item + 1} : std::nullopt;
+        }
+
+        // Transactions longer than this are sorted by a radix sort, shorter ones by insertion sort.
+        constexpr size_t min_radix_sort_items = 256;
+
+        // Buckets with fewer transactions than this are sorted by comparison.
+        constexpr size_t min_radix_sort_transactions = 64;
+
+        // Sorts the ranks of a transaction by an LSD radix sort on the bytes of the ranks.
+        auto radix_sort_items(const std::span<item_t> items, std::vector<item_t> &buffer, const size_t num_bytes)
+            -> void {
+            if (items.size() < min_radix_sort_items) {
+                std::ranges::sort(items);
+                return;
+            }
+
+            buffer.resize(items.size());
+            std::array<size_t, 256> counts{};
+
+            for (size_t byte = 0; byte < num_bytes; ++byte) {
+                const auto shift = 8 * byte;
+                const auto digit = [&](const item_t &item) { return (item >> shift) & 0xff; };
+
+                counts.fill(0);
+                for (const auto &item: items) {
+                    ++counts[digit(item)];
+                }
+                std::exclusive_scan(counts.begin(), counts.end(), counts.begin(), size_t{0});
+
+                for (const auto &item: items) {
+                    buffer[counts[digit(item)]++] = item;
+                }
+                std::ranges::copy(buffer | std::views::take(items.size()), items.begin());
+            }
+        }
+
+        // MSD radix sort of the positions of the transactions of a database of ranked items. The key of a
+        // transaction at a depth is its rank at this position; transactions ending before belong to the last
+        // bucket, since a longer transaction precedes its own prefix.
+        struct radix_sorter_t {
+            const database_t &database;
+            size_t num_keys; ///< The number of ranks; the key `num_keys` marks the end of a transaction.
+
+            [[nodiscard]] auto get_key(const size_t pos, const size_t depth) const -> size_t {
+                const auto begin = database.offsets[pos] + depth;
+                return begin < database.offsets[pos + 1] ? database.items[begin] : num_keys;
+            }
+
+            [[nodiscard]] auto get_suffix(const size_t pos, const size_t depth) const -> transaction_t {
+                return {database.items.data() + database.offsets[pos] + depth,
+                        database.items.data() + database.offsets[pos + 1]};
+            }
+
+            // Sorts the positions of transactions sharing their first `depth` items (the buffer has the same size).
+            auto sort(const std::span<size_t> positions, const std::span<size_t> buffer, size_t depth) const -> void {
+                std::vector<size_t> bounds{};
+
+                while (positions.size() > 1) {
+                    if (positions.size() < min_radix_sort_transactions || positions.size() * 8 < num_keys) {
+                        std::ranges::sort(positions, [&](const size_t x, const size_t y) {
+                            return lexicographical_compare(get_suffix(x, depth), get_suffix(y, depth));
+                        });
+                        return;
+                    }
+
+                    bounds.assign(num_keys + 2, 0);
+                    for (const auto pos: positions) {
+                        ++bounds[get_key(pos, depth) + 1];
+                    }
+
+                    // all transactions have the same key: no need to distribute them
+                    if (const auto key = get_key(positions.front(), depth); bounds[key + 1] == positions.size()) {
+                        if (key == num_keys) {
+                            return;
+                        }
+                        ++depth;
+                        continue;
+                    }
+
+                    std::inclusive_scan(bounds.begin(), bounds.end(), bounds.begin());
+                    auto next = bounds;
+                    for (const auto pos: positions) {
+                        buffer[next[get_key(pos, depth)]++] = pos;
+                    }
+                    std::ranges::copy(buffer.first(positions.size()), positions.begin());
+
+                    // the transactions of the last bucket are equal
+                    for (size_t key = 0; key < num_keys; ++key) {
+                        const auto size = bounds[key + 1] - bounds[key];
+                        if (size > 1) {
+                            sort(positions.subspan(bounds[key], size), buffer.subspan(bounds[key], size), depth + 1);
+                        }
+                    }
+                    return;
+                }
+            }
+        };
+
+        auto radix_sort_lexicographically_(database_t &database, const size_t num_keys, const size_t num_threads)
+            -> void {
+            const auto size = database.size();
+            const auto num_blocks = parallel::get_num_threads(
+                num_threads, std::max<size_t>(1, size / min_transactions_per_thread));
+
+            // sorts the ranks of each transaction in place
+            const auto num_bytes = std::max<size_t>(1, (std::bit_width(num_keys) + 7) / 8);
+
+            parallel::for_each_block(size, num_blocks, [&](size_t, const size_t begin, const size_t end) {
+                std::vector<item_t> buffer{};
+                for (auto pos = begin; pos < end; ++pos) {
+                    radix_sort_items(
+                        std::span{database.items}.subspan(
+                            database.offsets[pos], database.offsets[pos + 1] - database.offsets[pos]),
+                        buffer,
+                        num_bytes);
+                }
+            });
+
+            // distributes the positions into the buckets of their first rank, each thread a block of them
+            const radix_sorter_t sorter{database, num_keys};
+            std::vector<std::vector<size_t> > block_counts(num_blocks, std::vector<size_t>(num_keys + 1, 0));
+
+            parallel::for_each_block(size, num_blocks, [&](const size_t block, const size_t begin, const size_t end) {
+                for (auto pos = begin; pos < end; ++pos) {
+                    ++block_counts[block][sorter.get_key(pos, 0)];
+                }
+            });
+
+            std::vector<size_t> bounds(num_keys + 2, 0);
+            for (size_t key = 0, start = 0; key <= num_keys; ++key) {
+                bounds[key] = start;
+                for (auto &counts: block_counts) {
+                    start += std::exchange(counts[key], start);
+                }
+            }
+            bounds[num_keys + 1] = size;
+
+            std::vector<size_t> order(size);
+            parallel::for_each_block(size, num_blocks, [&](const size_t block, const size_t begin, const size_t end) {
+                auto &next = block_counts[block];
+                for (auto pos = begin; pos < end; ++pos) {
+                    order[next[sorter.get_key(pos, 0)]++] = pos;
+                }
+            });
+
+            // sorts the buckets independently, the largest ones first
+            std::vector<size_t> keys(num_keys);
+            std::iota(keys.begin(), keys.end(), 0);
+            std::ranges::sort(keys, std::ranges::greater{}, [&](const size_t key) {
+                return bounds[key + 1] - bounds[key];
+            });
+
+            std::vector<size_t> buffer(size);
+            // no more threads than for the blocks, so that small databases are sorted on the calling thread
+            parallel::for_each_task(num_keys, parallel::get_num_threads(num_blocks, num_keys), [&](const size_t task) {
+                const auto key = keys[task];
+                const auto bucket_size = bounds[key + 1] - bounds[key];
+                if (bucket_size > 1) {
+                    sorter.sort(std::span{order}.subspan(bounds[key], bucket_size),
+                                std::span{buffer}.subspan(bounds[key], bucket_size),
+                                1);
+                }
+            });
+
+            // copies the transactions in the sorted order
+            database_t sorted{};
+            sorted.items.resize(database.items.size());
+            sorted.offsets.resize(size + 1);
+            sorted.weights.resize(database.weights.size());
+
+            for (size_t i = 0; i < size; ++i) {
+                sorted.offsets[i + 1] = sorted.offsets[i] + database[order[i]].size();
+            }
+
+            parallel::for_each_block(size, num_blocks, [&](size_t, const size_t begin, const size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    std::ranges::copy(database[order[i]], sorted.items.begin() + static_cast<std::ptrdiff_t>(
+                                          sorted.offsets[i]));
+                    if (database.is_weighted()) {
+                        sorted.weights[i] = database.weights[order[i]];
+                    }
+                }
+            });
+            database = std::move(sorted);
+        }
+    }
+
+    auto database_t::radix_sort_lexicographically(const size_t num_threads) -> database_t & {
+        if (const auto num_keys = get_dense_universe(*this); num_keys.has_value()) {
+            radix_sort_lexicographically_(*this, *num_keys, num_threads);
+            return *this;
+        }
+        return sort_lexicographically(rank_compare_t{});
+    }
+
+    auto database_t::gray_code_sort(const size_t num_ranks) -> database_t & {
+        assert(num_ranks <= 64);
+
+        // the position of a pattern in the reflected Gray code is the prefix xor of its bits
+        const auto gray_code_position = [](std::uint64_t pattern) -> std::uint64_t {
+            for (unsigned shift = 1; shift < 64; shift <<= 1) {
+                pattern ^= pattern >> shift;
+            }
+            return pattern;
+        };
+
+        // the ranks ascend by support, so the most frequent ranks are the highest ones
+        const auto max_rank = items.empty() ? size_t{0} : static_cast<size_t>(std::ranges::max(items));
+
+        std::vector<std::uint64_t> keys(size(), 0);
+        for (size_t i = 0; i < size(); ++i) {
+            std::uint64_t pattern = 0;
+            for (const auto &rank: (*this)[i]) {
+                if (const auto distance = max_rank - static_cast<size_t>(rank); distance < num_ranks) {
+                    pattern |= std::uint64_t{1} << (63 - distance);
+                }
+            }
+            keys[i] = gray_code_position(pattern);
+        }
+
+        std::vector<size_t> order(size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, [&](const size_t x, const size_t y) { return keys[x] < keys[y]; });
+
+        permute_transactions(*this, order);
+        return *this;
+    }
+
+    namespace {
+        // Counts the items of a dense universe in flat arrays, one per thread, which are merged at the end. Each
+        // thread counts at least as many items as its array has counters, so the arrays do not outgrow the items.
+        auto count_dense_items(const database_t &database, const size_t num_keys, const size_t num_threads)
+            -> counts_t {
+            const auto num_blocks = parallel::get_num_threads(
+                num_threads,
+                std::max<size_t>(1, database.items.size() / std::max(min_items_per_thread, num_keys)));
+            std::vector<counts_t> block_counts(num_blocks);
+
+            parallel::for_each_block(database.size(), num_blocks, [&](const size_t block, size_t begin, size_t end) {
+                auto &counts = block_counts[block];
+                counts.assign(num_keys, 0);
+
+                if (not database.is_weighted()) {
+                    for (auto pos = database.offsets[begin]; pos < database.offsets[end]; ++pos) {
+                        ++counts[database.items[pos]];
+                    }
+                    return;
+                }
+
+                for (auto i = begin; i < end; ++i) {
+                    for (const auto &item: database[i]) {
+                        counts[item] += database.weights[i];
+                    }
+                }
+            });
+
+            auto counts = std::move(block_counts.front());
+            for (const auto &other: block_counts | std::views::drop(1)) {
+                std::ranges::transform(counts, other, counts.begin(), std::plus{});
+            }
+            return counts;
+        }
+    }
+
+    auto database_t::get_item_counts(const size_t num_threads) const -> item_counts_t {
         item_counts_t counts{};
-        for (const auto &item: *this | std::views::join) {
-            ++counts[item];
+
+        if (const auto num_keys = get_dense_universe(*this); num_keys.has_value()) {
+            const auto dense_counts = count_dense_items(*this, *num_keys, num_threads);
+            counts.reserve(num_keys.value() - std::ranges::count(dense_counts, 0));
+
+            for (size_t item = 0; item < dense_counts.size(); ++item) {
+                if (dense_counts[item] != 0) {
+                    counts.emplace(static_cast<item_t>(item), dense_counts[item]);
+                }
+            }
+            return counts;
+        }
+
+        for (size_t i = 0; i < size(); ++i) {
+            for (const auto &item: (*this)[i]) {
+                counts[item] += get_weight(i);
+            }
         }
-        return std::move(counts);
+        return counts;
     }
 
-    auto database_t::reduce_database(const size_t min_support) -> database_counts_t {
-        const auto &item_counts = get_item_counts();
+    namespace {
+        // Copies the items of the source database mapped by the given function into the target database;
+        // items mapped to std::nullopt and transactions without any remaining item are removed. The source
+        // and the target may be the same database, since no item is written behind the position it is read.
+        template<typename Map>
+        auto filter_items(const database_t &source, database_t &target, Map map_item) -> void {
+            const auto is_weighted = source.is_weighted();
 
-        // Remove items from transactions that do not meet the minimum support threshold
-        for (itemset_t &trans: *this) {
-            std::erase_if(trans, [&](const item_t &item) -> bool {
-                return item_counts.at(item) < min_support;
+            if (&source != &target) {
+                target.clear();
+                target.items.resize(source.items.size());
+                target.offsets.resize(source.offsets.size());
+                target.weights.resize(is_weighted ? source.size() : 0);
+            }
+
+            size_t begin = 0;
+            size_t num_items = 0;
+            size_t num_transactions = 0;
+
+            for (size_t i = 0; i < source.size(); ++i) {
+                const auto end = source.offsets[i + 1];
+                const auto start = num_items;
+
+                for (auto pos = begin; pos < end; ++pos) {
+                    if (const auto item = map_item(source.items[pos]); item.has_value()) {
+                        target.items[num_items++] = *item;
+                    }
+                }
+
+                begin = end;
+                if (num_items > start) {
+                    if (is_weighted) {
+                        target.weights[num_transactions] = source.weights[i];
+                    }
+                    target.offsets[++num_transactions] = num_items;
+                }
+            }
+
+            target.items.resize(num_items);
+            target.offsets.resize(num_transactions + 1);
+            target.weights.resize(is_weighted ? num_transactions : 0);
+        }
+
+        // Replaces the frequent items of the given database by their ranks and removes all others.
+        auto filter_ranked_items(const database_t &source, database_t &target, const item_ranks_t &item_ranks)
+            -> void {
+            filter_items(source, target, [&](const item_t &item) -> std::optional<item_t> {
+                const auto it = item_ranks.ranks.find(item);
+                return it != item_ranks.ranks.end() ? std::optional<item_t>{it->second} : std::nullopt;
             });
         }
 
-        // Remove empty itemsets from the database
-        std::erase_if(*this, [](const itemset_t &x) -> bool {
-            return x.empty();
-        });
+        // Removes the infrequent items from the given database and returns the counts of the frequent items.
+        auto filter_frequent_items(
+            const database_t &source,
+            database_t &target,
+            const size_t min_support,
+            const reduce_config_t &config) -> item_counts_t {
+            auto counts = source.get_item_counts(config.num_threads);
+
+            if (config.sort_algorithm == sort_algorithm_t::RADIX) {
+                // the radix sort uses the ranks as keys, which are mapped back to the items afterwards
+                const auto item_ranks = item_ranks_t::create(counts, min_support);
+                filter_ranked_items(source, target, item_ranks);
+
+                target.radix_sort_lexicographically(config.num_threads);
+                for (auto &item: target.items) {
+                    item = item_ranks.get_item(static_cast<rank_t>(item));
+                }
+            } else {
+                filter_items(source, target, [&](const item_t &item) -> std::optional<item_t> {
+                    return counts.at(item) >= min_support ? std::optional{item} : std::nullopt;
+                });
+            }
+
+            // the counts of the frequent items are not affected by removing the infrequent ones
+            std::erase_if(counts, [&](const auto &pair) { return pair.second < min_support; });
+
+            if (config.sort_algorithm == sort_algorithm_t::COMPARISON) {
+                target.sort_lexicographically(counts.get_item_compare());
+            }
+            return counts;
+        }
+
+        // Replaces the frequent items of the given database by their ranks, removes all others and sorts it.
+        auto rank_frequent_items(
+            const database_t &source,
+            database_t &target,
+            const size_t min_support,
+            const reduce_config_t &config) -> std::tuple<item_counts_t, item_ranks_t> {
+            auto item_ranks = item_ranks_t::create(source.get_item_counts(config.num_threads), min_support);
+            filter_ranked_items(source, target, item_ranks);
+
+            if (config.sort_algorithm == sort_algorithm_t::RADIX) {
+                target.radix_sort_lexicographically(config.num_threads);
+            } else {
+                target.sort_lexicographically(rank_compare_t{});
+            }
+            return {item_ranks.get_rank_counts(), std::move(item_ranks)};
+        }
+    }
+
+    auto database_t::reduce_database(const size_t min_support, const reduce_config_t &config) &
+        -> reduced_database_t {
+        auto counts = filter_frequent_items(*this, *this, min_support, config);
+        if (config.collapse_duplicates) {
+            collapse_duplicates();
+        }
+
+        return {*this, std::move(counts)};
+    }
+
+    auto database_t::reduce_database(const size_t min_support, const reduce_config_t &config) &&
+        -> database_counts_t {
+        auto counts = std::get<1>(reduce_database(min_support, config));
+        return {std::move(*this), std::move(counts)};
+    }
 
-        const auto &counts = get_item_counts();
-        sort_lexicographically(counts.get_item_compare());
+    auto database_t::transaction_reduction(const size_t min_support, const reduce_config_t &config) const &
+        -> database_counts_t {
+        database_t db{};
+        auto counts = std::get<1>(transaction_reduction(min_support, db, config));
 
-        return std::make_tuple(*this, counts);
+        return {std::move(db), std::move(counts)};
     }
 
-    auto database_t::transaction_reduction(const size_t min_support) const -> database_counts_t {
-        database_t db(*this); // copy database
-        return db.reduce_database(min_support);
+    auto database_t::transaction_reduction(const size_t min_support, const reduce_config_t &config) &&
+        -> database_counts_t {
+        return std::move(*this).reduce_database(min_support, config);
+    }
+
+    auto database_t::transaction_reduction(
+        const size_t min_support,
+        database_t &buffer,
+        const reduce_config_t &config) const & -> reduced_database_t {
+        auto counts = filter_frequent_items(*this, buffer, min_support, config);
+        if (config.collapse_duplicates) {
+            buffer.collapse_duplicates();
+        }
+
+        return {buffer, std::move(counts)};
+    }
+
+    auto database_t::rank_reduction(const size_t min_support, const reduce_config_t &config) const &
+        -> ranked_database_t {
+        database_t db{};
+        auto [rank_counts, item_ranks] = rank_frequent_items(*this, db, min_support, config);
+        if (config.collapse_duplicates) {
+            db.collapse_duplicates();
+        }
+
+        return {std::move(db), std::move(rank_counts), std::move(item_ranks)};
+    }
+
+    auto database_t::rank_reduction(const size_t min_support, const reduce_config_t &config) &&
+        -> ranked_database_t {
+        auto [rank_counts, item_ranks] = rank_frequent_items(*this, *this, min_support, config);
+        if (config.collapse_duplicates) {
+            collapse_duplicates();
+        }
+
+        return {std::move(*this), std::move(rank_counts), std::move(item_ranks)};
     }
 }
@@ -0,0 +1,91 @@
+/// @file database_cache.cpp
+/// @brief Implementation of the database cache.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include "database_cache.h"
+
+namespace fim {
+    auto database_cache_t::get_entry(const size_t min_support) -> entry_t & {
+        auto &entry = entries_[min_support];
+        if (not entry) {
+            entry = std::make_unique<entry_t>(
+                entry_t{.ranked_database = database_.rank_reduction(min_support, reduce_config)});
+        }
+        return *entry;
+    }
+
+    auto database_cache_t::push_back(const transaction_t &transaction, const size_t weight) -> void {
+        database_.push_back(transaction, weight);
+        invalidate();
+    }
+
+    auto database_cache_t::get_ranked_database(const size_t min_support) -> const ranked_database_t & {
+        return get_entry(min_support).ranked_database;
+    }
+
+    auto database_cache_t::get_vertical_database(const size_t min_support)
+        -> const algorithm::eclat::vertical_database_t & {
+        auto &entry = get_entry(min_support);
+        if (not entry.vertical_database.has_value()) {
+            entry.vertical_database = algorithm::eclat::to_vertical_database(std::get<0>(entry.ranked_database));
+        }
+        return *entry.vertical_database;
+    }
+
+    auto database_cache_t::get_fp_tree(const size_t min_support) -> const fp_tree::node_ptr & {
+        auto &entry = get_entry(min_support);
+        if (entry.fp_tree == nullptr) {
+            const auto &[db, item_counts, _] = entry.ranked_database;
+            entry.fp_tree = fp_tree::build_fp_tree(db, item_counts.get_frequent_items(min_support));
+        }
+        return entry.fp_tree;
+    }
+
+    auto database_cache_t::mine(
+        const algorithm::algorithm_t algorithm,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        using algorithm::algorithm_t;
+
+        const auto &[db, item_counts, item_ranks] = get_ranked_database(min_support);
+        const auto &items_sink = item_ranks.to_items(sink);
+
+        switch (algorithm) {
+            case algorithm_t::ECLAT:
+                algorithm::eclat::eclat_algorithm_(
+                    {db, item_counts}, get_vertical_database(min_support), min_support, items_sink, resource);
+                break;
+            case algorithm_t::FP_GROWTH:
+                algorithm::fp_growth::fp_growth_algorithm_(
+                    {db, item_counts}, get_fp_tree(min_support), min_support, items_sink, resource);
+                break;
+            default:
+                algorithm::get_sink_algorithm(algorithm)({db, item_counts}, min_support, items_sink, resource);
+        }
+    }
+}
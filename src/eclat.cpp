@@ -33,15 +33,28 @@
 #include "eclat.h"
 
 namespace fim::algorithm::eclat {
-    auto set_intersection(const tidset_t &x, const tidset_t &y) -> tidset_t {
-        tidset_t tidset{};
+    auto set_intersection(const tidset_t &x, const tidset_t &y, std::pmr::memory_resource *resource) -> tidset_t {
+        tidset_t tidset{resource};
         std::ranges::set_intersection(x, y, std::inserter(tidset, tidset.begin()));
 
         return tidset;
     }
 
-    auto to_vertical_database(const database_t &database) -> vertical_database_t {
-        vertical_database_t vertical_trans{};
+    auto get_support(const tidset_t &tidset, const database_t &database) -> size_t {
+        if (not database.is_weighted()) {
+            return tidset.size();
+        }
+
+        size_t support = 0;
+        for (const auto &tid: tidset) {
+            support += database.get_weight(tid);
+        }
+        return support;
+    }
+
+    auto to_vertical_database(const database_t &database, std::pmr::memory_resource *resource)
+        -> vertical_database_t {
+        vertical_database_t vertical_trans{resource};
         for (tid_t tid = 0; tid < database.size(); ++tid) {
             const auto &trans = database[tid];
 
@@ -53,62 +66,106 @@ namespace fim::algorithm::eclat {
     }
 
     auto eclat_algorithm(const database_t &database, const size_t min_support) -> itemsets_t {
-        const auto [db, item_counts] = database.transaction_reduction(min_support);
-        return eclat_algorithm_({db, item_counts}, min_support);
+        itemsets_t freq_itemsets{};
+        eclat_algorithm(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
     }
 
-    auto eclat_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t {
+    auto eclat_algorithm_(const database_view_t &database, const size_t min_support) -> itemsets_t {
         itemsets_t freq_itemsets{};
+        eclat_algorithm_(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
+    }
 
+    auto eclat_algorithm(
+        const database_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto [db, item_counts, item_ranks] = database.rank_reduction(
+            min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
+        eclat_algorithm_({db, item_counts}, min_support, item_ranks.to_items(sink), resource);
+    }
+
+    auto eclat_algorithm_(
+        const database_view_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto &vertical_trans = to_vertical_database(std::get<0>(database), resource);
+        eclat_algorithm_(database, vertical_trans, min_support, sink, resource);
+    }
+
+    auto eclat_algorithm_(
+        const database_view_t &database,
+        const vertical_database_t &vertical_database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
         const auto &[db, item_counts] = database;
-        const auto compare = item_counts.get_item_compare();
 
         // Creates initial tids.
         auto all_tids = [&]() -> tidset_t {
-            return std::ranges::iota_view(0)
-                   | std::views::take(db.size())
-                   | std::ranges::to<tidset_t>();
+            tidset_t tidset{resource};
+            for (tid_t tid = 0; tid < db.size(); ++tid) {
+                tidset.insert(tidset.end(), tid);
+            }
+            return tidset;
         };
 
-        auto create_frequent_itemset = [&](const item_t &item, const itemset_t &prefix) -> itemset_t {
-            itemset_t itemset = prefix;
-            itemset.add(item);
-            freq_itemsets.add(itemset);
-
-            return itemset;
+        // The pairs of all ranks up to the greatest frequent one are counted in one pass, so that the tidsets of
+        // the infrequent pairs are not intersected on the first level.
+        pair_counts_t pair_counts{};
+        if (item_counts.ranked) {
+            if (const auto num_ranks = pair_counts_t::get_num_ranks(item_counts, min_support);
+                pair_counts_t::fits(num_ranks)) {
+                pair_counts = pair_counts_t{db, num_ranks};
+            }
+        }
+        auto infrequent_pair = [&](const item_t x, const item_t y) {
+            const auto [lo, hi] = std::minmax(x, y);
+            return hi < pair_counts.num_ranks && pair_counts.get_count(lo, hi) < min_support;
         };
 
-        using func_t = std::function<void(const itemset_t &, const vertical_database_t &, const tidset_t &)>;
+        // The items of the current prefix; extended before and restored after each recursive call.
+        itemset_t prefix{};
+
+        using func_t = std::function<void(const vertical_database_t &, const tidset_t &)>;
         func_t eclat_ = [&](
-            const itemset_t &prefix,
             const vertical_database_t &vertical_trans,
             const tidset_t &current_tidset) -> void {
             for (auto it = vertical_trans.begin(); it != vertical_trans.end(); ++it) {
                 const auto &[item, tidset] = *it;
-                const auto &new_tidset = set_intersection(current_tidset, tidset);
 
-                if (new_tidset.size() >= min_support) {
-                    const auto &new_itemset = create_frequent_itemset(item, prefix);
-                    vertical_database_t new_vertical_trans{};
+                // the conditional tidsets of the item are released at once with their arena after it has been mined
+                std::pmr::monotonic_buffer_resource arena{resource};
+                const auto &new_tidset = set_intersection(current_tidset, tidset, &arena);
 
+                if (const auto support = get_support(new_tidset, db); support >= min_support) {
+                    prefix.add(item);
+                    sink(prefix, support);
+
+                    vertical_database_t new_vertical_trans{&arena};
                     for (auto jt = std::next(it); jt != vertical_trans.end(); ++jt) {
                         const auto &[new_item, new_item_tidset] = *jt;
-                        const auto &intersected_tidset = set_intersection(new_tidset, new_item_tidset);
+                        if (prefix.size() == 1 && infrequent_pair(item, new_item)) {
+                            continue;
+                        }
+
+                        auto intersected_tidset = set_intersection(new_tidset, new_item_tidset, &arena);
 
                         if (!intersected_tidset.empty()) {
-                            new_vertical_trans[new_item] = intersected_tidset;
+                            new_vertical_trans.emplace(new_item, std::move(intersected_tidset));
                         }
                     }
 
                     // Recursive call
-                    eclat_(new_itemset, new_vertical_trans, new_tidset);
+                    eclat_(new_vertical_trans, new_tidset);
+                    prefix.pop_back();
                 }
             }
         };
 
-        const auto &vertical_trans = to_vertical_database(db);
-        eclat_({}, vertical_trans, all_tids());
-
-        return freq_itemsets;
+        eclat_(vertical_database, all_tids());
     }
 }
@@ -37,72 +37,211 @@ namespace fim::algorithm::fp_growth {
     using std::views::filter;
     using std::views::transform;
 
-    auto conditional_transactions(const node_ptr &root, const item_t item, const item_compare_t &compare) -> database_t {
-        database_t transactions{};
+    namespace {
+        template<typename Compare>
+        auto conditional_transactions_(const node_ptr &root, const item_t item, const Compare &compare) -> database_t {
+            database_t transactions{};
 
-        std::function<void(const node_ptr &)> conditional_transactions_ = [&](const node_ptr &node) -> void {
-            // traverses from a given node to the root and collects the items along the path with regard to the frequency
-            auto collect_path = [&](const node_ptr &n) -> itemset_t {
-                itemset_t path{};
+            std::function<void(const node_ptr &)> collect_transactions = [&](const node_ptr &node) -> void {
+                // traverses from a given node to the root and collects the items along the path with regard to the frequency
+                auto collect_path = [&](const node_ptr &n) -> itemset_t {
+                    itemset_t path{};
 
-                node_ptr current = n->parent.lock();
-                while (!current->is_root()) {
-                    path.add(current->item);
-                    current = current->parent.lock();
-                }
-                return path.sort_itemset(compare);
-            };
+                    node_ptr current = n->parent.lock();
+                    while (!current->is_root()) {
+                        path.add(current->item);
+                        current = current->parent.lock();
+                    }
+                    return path.sort_itemset(compare);
+                };
 
-            if (node->item == item) {
-                itemset_t items = collect_path(node);
-                for (int i = 0; i < node->frequency; ++i) {
-                    if (not items.empty()) {
-                        transactions.emplace_back(items);
+                if (not node->is_root() && node->item == item) {
+                    // the path occurs as often as the node, so it is added once with this frequency as its weight
+                    if (const itemset_t items = collect_path(node); not items.empty()) {
+                        transactions.push_back(items, node->frequency);
+                    }
+                } else {
+                    for (const auto &child: node->children) {
+                        collect_transactions(child);
                     }
                 }
-            } else {
-                for (const auto &child: node->children) {
-                    conditional_transactions_(child);
-                }
-            }
-        };
+            };
 
-        conditional_transactions_(root);
-        return transactions;
+            collect_transactions(root);
+            return transactions;
+        }
     }
 
-    auto fp_growth_algorithm(const database_t &database, const size_t min_support) -> itemsets_t {
-        const auto [db, item_counts] = database.transaction_reduction(min_support);
-        return fp_growth_algorithm_({db, item_counts}, min_support);
+    auto conditional_transactions(const node_ptr &root, const item_t item, const item_compare_t &compare) -> database_t {
+        return conditional_transactions_(root, item, compare);
     }
 
-    auto fp_growth_algorithm_(const database_counts_t &database, size_t min_support) -> itemsets_t {
-        itemsets_t freq_itemsets{};
+    auto conditional_transactions(const node_ptr &root, const item_t item, const rank_compare_t &compare) -> database_t {
+        return conditional_transactions_(root, item, compare);
+    }
 
-        const auto &[db, item_counts] = database;
-        const auto compare = item_counts.get_item_compare();
+    namespace {
+        // The reduction of the (conditional) databases.
+        constexpr auto reduce_config = reduce_config_t{
+            .collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX
+        };
 
-        const auto update_frequent_itemsets = [&](const item_t &item, const itemsets_t &itemsets) {
-            freq_itemsets.add(itemset_t{item});
-            freq_itemsets.add(itemsets);
+        // The conditional databases are many and mostly small, so they are sorted on the calling thread.
+        constexpr auto conditional_reduce_config = reduce_config_t{
+            .collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX, .num_threads = 1
         };
 
-        const auto &freq_items = item_counts.get_frequent_items(min_support);
-        const auto &root = build_fp_tree(db, freq_items);
-        const auto &items_along_path = tree_is_single_path(root);
+        // Passes all non-empty subsets of the items along a single path, extending the given prefix, to the sink.
+        // The items are ordered by descending frequency, so the support of a subset is the count of its last item.
+        auto power_set_to_sink(
+            itemset_t &prefix,
+            const itemset_t &items,
+            const size_t first,
+            const item_counts_t &item_counts,
+            const itemset_sink_t &sink) -> void {
+            for (auto i = first; i < items.size(); ++i) {
+                prefix.add(items[i]);
+                sink(prefix, item_counts.at(items[i]));
+
+                power_set_to_sink(prefix, items, i + 1, item_counts, sink);
+                prefix.pop_back();
+            }
+        }
 
-        if (items_along_path.has_value()) {
-            return power_set(items_along_path.value(), false);
+        // Ranks a (conditional) database, mines it and maps the ranks of the found itemsets back to its items.
+        auto mine_conditional_database(
+            database_t &&database,
+            const size_t min_support,
+            const itemset_sink_t &sink,
+            std::pmr::memory_resource *resource,
+            const reduce_config_t &config = reduce_config) -> void {
+            const auto [db, item_counts, item_ranks] = std::move(database).rank_reduction(min_support, config);
+            fp_growth_algorithm_({db, item_counts}, min_support, item_ranks.to_items(sink), resource);
         }
 
-        // traverses all frequent items in the reversed order
-        for (auto &item: std::ranges::reverse_view(freq_items)) {
-            const auto &cond_trans = conditional_transactions(root, item, compare);
-            const auto &cond_itemsets = fp_growth_algorithm(cond_trans, min_support);
-            const auto &itemsets = insert_into_each_itemsets(cond_itemsets, item);
+        // Mines the frequent itemsets of an FP-tree of a reduced database with the given item's frequencies.
+        auto mine_fp_tree(
+            const item_counts_t &item_counts,
+            const node_ptr &root,
+            const size_t min_support,
+            const itemset_sink_t &sink,
+            std::pmr::memory_resource *resource) -> void {
+            const auto &freq_items = item_counts.get_frequent_items(min_support);
+            const auto &items_along_path = tree_is_single_path(root);
+
+            if (items_along_path.has_value()) {
+                itemset_t prefix{};
+                power_set_to_sink(prefix, items_along_path.value(), 0, item_counts, sink);
+                return;
+            }
+
+            // traverses all frequent items in the reversed order; the frequent itemsets of the conditional
+            // transactions of an item are passed on with the item as their prefix
+            item_counts.visit_item_compare([&](const auto &compare) {
+                for (auto &item: std::ranges::reverse_view(freq_items)) {
+                    itemset_t itemset{item};
+                    sink(itemset, item_counts.at(item));
 
-            update_frequent_itemsets(item, itemsets);
+                    const auto prefixed_sink = [&](const transaction_t &suffix, const size_t support) {
+                        itemset.resize(1);
+                        std::ranges::copy(suffix, std::back_inserter(itemset));
+                        sink(itemset, support);
+                    };
+                    mine_conditional_database(conditional_transactions(root, item, compare), min_support,
+                                              prefixed_sink, resource, conditional_reduce_config);
+                }
+            });
         }
+    }
+
+    auto fp_growth_algorithm(const database_t &database, const size_t min_support) -> itemsets_t {
+        itemsets_t freq_itemsets{};
+        fp_growth_algorithm(database, min_support, append_to(freq_itemsets));
         return freq_itemsets;
     }
+
+    auto fp_growth_algorithm(database_t &&database, const size_t min_support) -> itemsets_t {
+        itemsets_t freq_itemsets{};
+        mine_conditional_database(std::move(database), min_support, append_to(freq_itemsets),
+                                  std::pmr::get_default_resource());
+        return freq_itemsets;
+    }
+
+    auto fp_growth_algorithm_(const database_view_t &database, const size_t min_support) -> itemsets_t {
+        itemsets_t freq_itemsets{};
+        fp_growth_algorithm_(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
+    }
+
+    auto fp_growth_trie(const database_t &database, const size_t min_support) -> itemset_trie_t {
+        const auto [db, item_counts, item_ranks] = database.rank_reduction(min_support, reduce_config);
+
+        itemset_trie_t trie{};
+        fp_growth_trie_({db, item_counts}, min_support, trie);
+        return item_ranks.to_items(std::move(trie));
+    }
+
+    auto fp_growth_trie_(const database_view_t &database, const size_t min_support, itemset_trie_t &trie) -> void {
+        trie_builder_t builder{trie};
+        fp_growth_algorithm_(database, min_support, std::ref(builder));
+    }
+
+    auto fp_growth_algorithm(
+        const database_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto [db, item_counts, item_ranks] = database.rank_reduction(min_support, reduce_config);
+        fp_growth_algorithm_({db, item_counts}, min_support, item_ranks.to_items(sink), resource);
+    }
+
+    auto fp_growth_algorithm_(
+        const database_view_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto &[db, item_counts] = database;
+
+        // the nodes of the tree are released at once with their arena after the tree has been mined
+        std::pmr::monotonic_buffer_resource tree_resource{resource};
+
+        const auto &root = build_fp_tree(db, item_counts.get_frequent_items(min_support), &tree_resource);
+        fp_growth_algorithm_(database, root, min_support, sink, resource);
+    }
+
+    auto fp_growth_compressed(
+        database_t &&database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        auto [db, item_counts, item_ranks] = std::move(database).rank_reduction(min_support, reduce_config);
+
+        // only the compressed transactions are kept while mining
+        const compressed_database_t compressed{db};
+        db = database_t{};
+        fp_growth_compressed_({compressed, item_counts}, min_support, item_ranks.to_items(sink), resource);
+    }
+
+    auto fp_growth_compressed_(
+        const compressed_database_view_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto &[db, item_counts] = database;
+
+        // the nodes of the tree are released at once with their arena after the tree has been mined
+        std::pmr::monotonic_buffer_resource tree_resource{resource};
+
+        const auto &root = build_fp_tree(db, item_counts.get_frequent_items(min_support), &tree_resource);
+        mine_fp_tree(item_counts, root, min_support, sink, resource);
+    }
+
+    auto fp_growth_algorithm_(
+        const database_view_t &database,
+        const node_ptr &root,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        mine_fp_tree(std::get<1>(database), root, min_support, sink, resource);
+    }
 }
@@ -37,20 +37,27 @@ namespace fim::fp_tree {
     using std::ranges::find;
     using std::ranges::to;
 
-    node_t::node_t(const item_t item, const size_t frequency, const std::shared_ptr<node_t> &parent)
-        : item(item), frequency(frequency), parent(parent), children({}) {
+    node_t::node_t(
+        const item_t item,
+        const size_t frequency,
+        const std::shared_ptr<node_t> &parent,
+        std::pmr::memory_resource *resource)
+        : item(item), frequency(frequency), parent(parent), children(resource) {
     }
 
     bool node_t::is_root() const {
-        return item == 0 && frequency == 0;
+        // items are dense ranks starting at zero, so only the missing parent identifies the root
+        return parent.expired();
     }
 
-    node_ptr node_t::create_root() {
-        return std::make_shared<node_t>(node_t(0, 0, nullptr));
+    node_ptr node_t::create_root(std::pmr::memory_resource *resource) {
+        return std::allocate_shared<node_t>(std::pmr::polymorphic_allocator<node_t>{resource}, 0, 0, nullptr, resource);
     }
 
     node_ptr node_t::add_child(const item_t &child_item, size_t child_frequency) {
-        auto child = std::make_shared<node_t>(child_item, child_frequency, shared_from_this());
+        const auto resource = children.get_allocator().resource();
+        const auto allocator = std::pmr::polymorphic_allocator<node_t>{resource};
+        auto child = std::allocate_shared<node_t>(allocator, child_item, child_frequency, shared_from_this(), resource);
         children.emplace_back(child);
         return child;
     }
@@ -162,12 +169,12 @@ namespace fim::fp_tree {
                | to<itemsets_t>();
     }
 
-    auto filter_and_sort_items(const itemset_t &itemset, const items_t &freq_items) -> items_t {
-        auto is_frequent = [&](const auto &item) { return find(itemset, item) != itemset.end(); };
+    auto filter_and_sort_items(const transaction_t &transaction, const items_t &freq_items) -> items_t {
+        auto is_frequent = [&](const auto &item) { return find(transaction, item) != transaction.end(); };
 
         auto items = freq_items
                      | filter(is_frequent)
-                     | to<std::vector>();
+                     | to<items_t>();
 
         std::ranges::sort(items, [&](const item_t &x, const item_t &y) {
             return find(freq_items, x) < find(freq_items, y);
@@ -176,27 +183,46 @@ namespace fim::fp_tree {
         return items;
     }
 
-    auto build_fp_tree(const database_t &database, const items_t &freq_items) -> node_ptr {
-        auto root = node_t::create_root();
-
-        auto insert_items = [&](const items_t &items) {
-            auto current = root;
-            for (auto it = items.begin(); it != items.end(); ++it) {
-                const auto item = *it;
-                const auto node = current->find_child_item(item)
-                        .or_else([&]() -> std::optional<node_ptr> { return current->add_child(item, 0); })
-                        .value();
+    namespace {
+        template<typename Database>
+        auto build_fp_tree_(
+            const Database &database,
+            const items_t &freq_items,
+            std::pmr::memory_resource *resource) -> node_ptr {
+            auto root = node_t::create_root(resource);
+
+            auto insert_items = [&](const items_t &items, const size_t weight) {
+                auto current = root;
+                for (auto it = items.begin(); it != items.end(); ++it) {
+                    const auto item = *it;
+                    const auto node = current->find_child_item(item)
+                            .or_else([&]() -> std::optional<node_ptr> { return current->add_child(item, 0); })
+                            .value();
+
+                    node->frequency += weight;
+                    current = node;
+                }
+            };
 
-                node->frequency++;
-                current = node;
-            }
-        };
+            for_each_transaction(database, [&](const transaction_t &transaction, const size_t weight) {
+                insert_items(filter_and_sort_items(transaction, freq_items), weight);
+            });
 
-        for (const auto &trans: database) {
-            const auto &itemset = filter_and_sort_items(trans, freq_items);
-            insert_items(itemset);
+            return root;
         }
+    }
+
+    auto build_fp_tree(
+        const database_t &database,
+        const items_t &freq_items,
+        std::pmr::memory_resource *resource) -> node_ptr {
+        return build_fp_tree_(database, freq_items, resource);
+    }
 
-        return root;
+    auto build_fp_tree(
+        const compressed_database_t &database,
+        const items_t &freq_items,
+        std::pmr::memory_resource *resource) -> node_ptr {
+        return build_fp_tree_(database, freq_items, resource);
     }
 }
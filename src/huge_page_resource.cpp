@@ -0,0 +1,193 @@
+/// @file huge_page_resource.cpp
+/// @brief Implementation of the memory resource backed by huge pages.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "huge_page_resource.h"
+
+// Huge pages can be disabled by the library configuration (FIM_HUGE_PAGES), then the upstream resource is used.
+#ifndef FIM_HUGE_PAGES
+#define FIM_HUGE_PAGES 1
+#endif
+
+#if defined(__linux__) && FIM_HUGE_PAGES
+#define FIM_MAP_CHUNKS 1
+#include <sys/mman.h>
+#else
+#define FIM_MAP_CHUNKS 0
+#endif
+
+namespace fim {
+    namespace {
+        // The minimum alignment and size granularity of the allocated blocks.
+        constexpr size_t min_alignment = alignof(std::max_align_t);
+
+        auto round_up(const size_t value, const size_t multiple) -> size_t {
+            return (value + multiple - 1) / multiple * multiple;
+        }
+
+        auto align_up(std::byte *p, const size_t alignment) -> std::byte * {
+            const auto address = reinterpret_cast<std::uintptr_t>(p);
+            return p + (round_up(address, alignment) - address);
+        }
+    }
+
+    huge_page_resource_t::huge_page_resource_t(const size_t chunk_size, std::pmr::memory_resource *upstream)
+        : chunk_size_(round_up(std::max<size_t>(chunk_size, 1), huge_page_size)), upstream_(upstream) {
+    }
+
+    huge_page_resource_t::~huge_page_resource_t() {
+#if FIM_MAP_CHUNKS
+        for (const auto &[data, size]: chunks_) {
+            munmap(data, size);
+        }
+#endif
+    }
+
+    auto huge_page_resource_t::mapped_bytes() const -> size_t {
+        size_t bytes = 0;
+        for (const auto &chunk: chunks_) {
+            bytes += chunk.size;
+        }
+        return bytes;
+    }
+
+    auto huge_page_resource_t::huge_pages_advised() const -> bool {
+        return advised_;
+    }
+
+    auto huge_page_resource_t::huge_pages() const -> size_t {
+        // sums the AnonHugePages of all mappings that overlap a chunk
+        std::ifstream smaps("/proc/self/smaps");
+        std::string line;
+        bool overlaps = false;
+        size_t kilobytes = 0;
+
+        while (std::getline(smaps, line)) {
+            std::uintptr_t begin = 0;
+            std::uintptr_t end = 0;
+            char dash = 0;
+
+            if (std::istringstream range(line); range >> std::hex >> begin >> dash >> end && dash == '-') {
+                overlaps = std::ranges::any_of(chunks_, [&](const chunk_t &chunk) {
+                    const auto data = reinterpret_cast<std::uintptr_t>(chunk.data);
+                    return begin < data + chunk.size && data < end;
+                });
+            } else if (overlaps && line.starts_with("AnonHugePages:")) {
+                kilobytes += std::stoull(line.substr(line.find(':') + 1));
+            }
+        }
+        return kilobytes * 1024 / huge_page_size;
+    }
+
+    auto huge_page_resource_t::upstream_bytes() const -> size_t {
+        return upstream_bytes_;
+    }
+
+    auto huge_page_resource_t::map_chunk(const size_t min_size) -> bool {
+#if FIM_MAP_CHUNKS
+        // maps one more huge page than required, so that the chunk can be aligned to a huge page boundary
+        const auto size = round_up(std::max(min_size, chunk_size_), huge_page_size);
+        const auto mapped_size = size + huge_page_size;
+        void *mapped = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+
+        const auto begin = static_cast<std::byte *>(mapped);
+        const auto data = align_up(begin, huge_page_size);
+        const auto tail = static_cast<size_t>(begin + mapped_size - (data + size));
+        if (data != begin) {
+            munmap(begin, static_cast<size_t>(data - begin));
+        }
+        if (tail > 0) {
+            munmap(data + size, tail);
+        }
+
+#if defined(MADV_HUGEPAGE)
+        // fails (with EINVAL) if the kernel doesn't support transparent huge pages; the chunk is used anyway
+        advised_ = madvise(data, size, MADV_HUGEPAGE) == 0 || advised_;
+#endif
+
+        chunks_.push_back({data, size});
+        current_ = data;
+        end_ = data + size;
+        return true;
+#else
+        static_cast<void>(min_size);
+        return false;
+#endif
+    }
+
+    auto huge_page_resource_t::do_allocate(const size_t bytes, const size_t alignment) -> void * {
+        const auto size = round_up(std::max<size_t>(bytes, 1), min_alignment);
+        const auto block_alignment = std::max(alignment, min_alignment);
+
+        // reuses a deallocated block of the same size
+        if (const auto it = free_blocks_.find(size); it != free_blocks_.end() && not it->second.empty()) {
+            const auto p = it->second.back();
+            if (reinterpret_cast<std::uintptr_t>(p) % block_alignment == 0) {
+                it->second.pop_back();
+                return p;
+            }
+        }
+
+        auto p = current_ != nullptr ? align_up(current_, block_alignment) : nullptr;
+        if (p == nullptr || p + size > end_) {
+            if (not map_chunk(size + block_alignment)) {
+                upstream_bytes_ += bytes;
+                return upstream_->allocate(bytes, alignment);
+            }
+            p = align_up(current_, block_alignment);
+        }
+
+        current_ = p + size;
+        return p;
+    }
+
+    auto huge_page_resource_t::do_deallocate(void *p, const size_t bytes, const size_t alignment) -> void {
+        const auto block = static_cast<std::byte *>(p);
+        const auto in_chunk = std::ranges::any_of(chunks_, [&](const chunk_t &chunk) {
+            return chunk.data <= block && block < chunk.data + chunk.size;
+        });
+
+        if (not in_chunk) {
+            upstream_->deallocate(p, bytes, alignment);
+            return;
+        }
+        free_blocks_[round_up(std::max<size_t>(bytes, 1), min_alignment)].push_back(p);
+    }
+
+    auto huge_page_resource_t::do_is_equal(const memory_resource &other) const noexcept -> bool {
+        return this == &other;
+    }
+}
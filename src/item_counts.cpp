@@ -28,7 +28,14 @@
 
 #include "item_counts.h"
 #include "database.h"
+#include "bit_database.h"
+#include "compressed_database.h"
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
 
 namespace fim {
     auto item_counts_t::get_frequent_items(size_t min_support) const -> itemset_t {
@@ -41,13 +48,20 @@ namespace fim {
                      | std::ranges::to<itemset_t>();
 
         std::ranges::sort(items, [&](const item_t &x, const item_t &y) {
-            return at(x) > at(y);
+            const auto weight_x = at(x);
+            const auto weight_y = at(y);
+
+            return weight_x != weight_y ? weight_x > weight_y : x < y;
         });
 
         return items;
     }
 
     auto item_counts_t::get_item_compare() const -> item_compare_t {
+        if (ranked) {
+            return default_item_compare;
+        }
+
         return [&](const item_t &i, const item_t &j) -> bool {
             const auto weight_i = at(i);
             const auto weight_j = at(j);
@@ -65,27 +79,345 @@ namespace fim {
         };
     }
 
+    auto item_ranks_t::create(const item_counts_t &item_counts, const size_t min_support) -> item_ranks_t {
+        item_ranks_t item_ranks{};
+
+        item_ranks.items = item_counts.get_frequent_items(min_support);
+        std::ranges::sort(item_ranks.items, item_counts.get_item_compare());
+
+        item_ranks.counts.reserve(item_ranks.items.size());
+        item_ranks.ranks.reserve(item_ranks.items.size());
+
+        for (rank_t rank = 0; rank < item_ranks.items.size(); ++rank) {
+            const auto &item = item_ranks.items[rank];
+            item_ranks.counts.push_back(item_counts.at(item));
+            item_ranks.ranks.emplace(item, rank);
+        }
+        return item_ranks;
+    }
+
+    auto item_ranks_t::size() const -> size_t {
+        return items.size();
+    }
+
+    auto item_ranks_t::contains(const item_t &item) const -> bool {
+        return ranks.contains(item);
+    }
+
+    auto item_ranks_t::get_rank(const item_t &item) const -> rank_t {
+        return ranks.at(item);
+    }
+
+    auto item_ranks_t::get_item(const rank_t rank) const -> item_t {
+        return items[rank];
+    }
+
+    auto item_ranks_t::get_rank_counts() const -> item_counts_t {
+        item_counts_t rank_counts{};
+        rank_counts.reserve(counts.size());
+
+        for (rank_t rank = 0; rank < counts.size(); ++rank) {
+            rank_counts.emplace(rank, counts[rank]);
+        }
+
+        rank_counts.ranked = true;
+        return rank_counts;
+    }
+
+    auto item_ranks_t::to_items(const transaction_t &itemset) const -> itemset_t {
+        return itemset
+               | std::views::transform([&](const item_t &rank) { return items[rank]; })
+               | std::ranges::to<itemset_t>();
+    }
+
+    auto item_ranks_t::to_items(const itemsets_t &itemsets) const -> itemsets_t {
+        itemsets_t result{};
+        result.reserve(itemsets.size());
+
+        for (const auto &itemset: itemsets) {
+            result.emplace_back(to_items(itemset));
+        }
+        return result;
+    }
+
+    auto item_ranks_t::to_items(itemset_trie_t trie) const -> itemset_trie_t {
+        trie.transform_items([&](const item_t &rank) { return items[rank]; });
+        return trie;
+    }
+
+    auto item_ranks_t::to_items(const itemset_sink_t &sink) const -> itemset_sink_t {
+        return [this, sink](const transaction_t &itemset, const size_t support) {
+            sink(to_items(itemset), support);
+        };
+    }
+
+    namespace {
+        // Number of slots of an empty table that is inserted into; the table is kept at most half full.
+        constexpr size_t min_num_slots = 16;
+
+        // Number of itemsets whose slots are prefetched before they are probed.
+        constexpr size_t lookup_batch_size = 16;
+
+        // A slot stores the upper half of the hash together with the index + 1 of the itemset.
+        auto make_slot(const std::uint64_t hash, const size_t index) -> std::uint64_t {
+            return (hash & 0xffffffff00000000) | (index + 1);
+        }
+
+        auto get_index(const std::uint64_t slot) -> size_t {
+            return (slot & 0xffffffff) - 1;
+        }
+
+        auto prefetch(const void *address) -> void {
+#if defined(__GNUC__)
+            __builtin_prefetch(address);
+#endif
+        }
+
+        // Gets the position of the slot of the itemset or of the empty slot where it is to be inserted.
+        auto probe(const itemset_counts_t &table, const transaction_t &itemset, const std::uint64_t hash) -> size_t {
+            const auto mask = table.slots.size() - 1;
+            for (auto pos = hash & mask;; pos = (pos + 1) & mask) {
+                const auto slot = table.slots[pos];
+                if (slot == 0 || ((slot ^ hash) >> 32 == 0 && table.get_itemset(get_index(slot)) == itemset)) {
+                    return pos;
+                }
+            }
+        }
+    }
+
+    auto itemset_counts_t::reserve(const size_t num_itemsets, const size_t num_items) -> void {
+        offsets.reserve(num_itemsets + 1);
+        items.reserve(num_items);
+        counts.reserve(num_itemsets);
+
+        while (slots.size() < 2 * num_itemsets) {
+            grow();
+        }
+    }
+
+    auto itemset_counts_t::grow() -> void {
+        slots.assign(std::max(min_num_slots, 2 * slots.size()), 0);
+
+        constexpr itemset_hash hash_itemset{};
+        for (size_t index = 0; index < size(); ++index) {
+            const auto hash = hash_itemset(get_itemset(index));
+            slots[probe(*this, get_itemset(index), hash)] = make_slot(hash, index);
+        }
+    }
+
+    auto itemset_counts_t::find(const transaction_t &itemset) const -> std::optional<size_t> {
+        if (slots.empty()) {
+            return std::nullopt;
+        }
+
+        const auto slot = slots[probe(*this, itemset, itemset_hash{}(itemset))];
+        return slot != 0 ? std::optional{get_index(slot)} : std::nullopt;
+    }
+
+    auto itemset_counts_t::insert(const transaction_t &itemset) -> size_t {
+        if (2 * (size() + 1) > slots.size()) {
+            grow();
+        }
+
+        const auto hash = itemset_hash{}(itemset);
+        auto &slot = slots[probe(*this, itemset, hash)];
+        if (slot != 0) {
+            return get_index(slot);
+        }
+
+        const auto index = size();
+        items.insert(items.end(), itemset.begin(), itemset.end());
+        offsets.push_back(items.size());
+        counts.push_back(0);
+
+        slot = make_slot(hash, index);
+        return index;
+    }
+
+    auto itemset_counts_t::operator[](const transaction_t &itemset) -> size_t & {
+        return counts[insert(itemset)];
+    }
+
+    auto itemset_counts_t::contains(const transaction_t &itemset) const -> bool {
+        return find(itemset).has_value();
+    }
+
+    auto itemset_counts_t::at(const transaction_t &itemset) const -> size_t {
+        const auto index = find(itemset);
+        if (not index.has_value()) {
+            throw std::out_of_range("itemset_counts_t::at: itemset not found");
+        }
+        return counts[*index];
+    }
+
+    auto itemset_counts_t::get_counts(const itemsets_t &itemsets) const -> counts_t {
+        counts_t result(itemsets.size(), 0);
+        if (slots.empty()) {
+            return result;
+        }
+
+        constexpr itemset_hash hash_itemset{};
+        std::array<std::uint64_t, lookup_batch_size> hashes{};
+
+        for (size_t begin = 0; begin < itemsets.size(); begin += lookup_batch_size) {
+            const auto end = std::min(begin + lookup_batch_size, itemsets.size());
+
+            for (auto i = begin; i < end; ++i) {
+                hashes[i - begin] = hash_itemset(itemsets[i]);
+                prefetch(&slots[hashes[i - begin] & (slots.size() - 1)]);
+            }
+
+            for (auto i = begin; i < end; ++i) {
+                if (const auto slot = slots[probe(*this, itemsets[i], hashes[i - begin])]; slot != 0) {
+                    result[i] = counts[get_index(slot)];
+                }
+            }
+        }
+        return result;
+    }
+
+    namespace {
+        // Creates the table of the itemsets with a positive support.
+        auto create_itemset_counts_(const itemsets_t &itemsets, const counts_t &supports) -> itemset_counts_t {
+            itemset_counts_t count{};
+            count.reserve(itemsets.size());
+
+            for (size_t i = 0; i < itemsets.size(); ++i) {
+                if (supports[i] > 0) {
+                    count[itemsets[i]] += supports[i];
+                }
+            }
+            return count;
+        }
+
+        template<typename Compare>
+        auto create_itemset_counts_(
+            const database_t &transactions,
+            const itemsets_t &itemsets,
+            const Compare &compare) -> itemset_counts_t {
+            counts_t supports(itemsets.size(), 0);
+
+            for (size_t k = 0; k < itemsets.size(); ++k) {
+                for (size_t i = 0; i < transactions.size(); ++i) {
+                    if (itemsets[k].is_subset(transactions[i], compare)) {
+                        supports[k] += transactions.get_weight(i);
+                    }
+                }
+            }
+            return create_itemset_counts_(itemsets, supports);
+        }
+
+        // The compressed transactions are decoded only once, so the loops are swapped.
+        template<typename Compare>
+        auto create_itemset_counts_(
+            const compressed_database_t &transactions,
+            const itemsets_t &itemsets,
+            const Compare &compare) -> itemset_counts_t {
+            counts_t supports(itemsets.size(), 0);
+
+            for_each_transaction(transactions, [&](const transaction_t &transaction, const size_t weight) {
+                for (size_t k = 0; k < itemsets.size(); ++k) {
+                    if (itemsets[k].is_subset(transaction, compare)) {
+                        supports[k] += weight;
+                    }
+                }
+            });
+            return create_itemset_counts_(itemsets, supports);
+        }
+    }
+
+    auto itemset_counts_t::create_itemset_counts(
+        const database_t &transactions,
+        const itemsets_t &itemsets,
+        const item_compare_t &compare) -> itemset_counts_t {
+        return create_itemset_counts_(transactions, itemsets, compare);
+    }
+
     auto itemset_counts_t::create_itemset_counts(
         const database_t &transactions,
         const itemsets_t &itemsets,
+        const rank_compare_t &compare) -> itemset_counts_t {
+        // the transactions of few ranks are counted as bitsets
+        return std::visit([&]<typename Matrix>(const Matrix &matrix) -> itemset_counts_t {
+            if constexpr (std::is_same_v<Matrix, std::monostate>) {
+                return create_itemset_counts_(transactions, itemsets, compare);
+            } else {
+                return create_itemset_counts_(itemsets, matrix.get_supports(itemsets));
+            }
+        }, create_bit_matrix(transactions));
+    }
+
+    auto itemset_counts_t::create_itemset_counts(
+        const compressed_database_t &transactions,
+        const itemsets_t &itemsets,
         const item_compare_t &compare) -> itemset_counts_t {
-        itemset_counts_t count{};
+        return create_itemset_counts_(transactions, itemsets, compare);
+    }
+
+    auto itemset_counts_t::create_itemset_counts(
+        const compressed_database_t &transactions,
+        const itemsets_t &itemsets,
+        const rank_compare_t &compare) -> itemset_counts_t {
+        return create_itemset_counts_(transactions, itemsets, compare);
+    }
+
+    pair_counts_t::pair_counts_t(const database_t &database, const size_t num_ranks) : num_ranks(num_ranks) {
+        assert(fits(num_ranks));
+
+        // the row x holds the pairs (x, x + 1), ..., (x, num_ranks - 1) from the position pos on; its offset
+        // pos - x - 1 may wrap around, which the addition of y > x reverts
+        rows.reserve(num_ranks);
+        for (size_t x = 0, pos = 0; x < num_ranks; pos += num_ranks - x - 1, ++x) {
+            rows.push_back(pos - x - 1);
+        }
+        counts.assign(num_ranks < 2 ? 0 : num_ranks * (num_ranks - 1) / 2, 0);
+
+        for (size_t i = 0; i < database.size(); ++i) {
+            const auto transaction = database[i];
+            const auto weight = database.get_weight(i);
+
+            // the ranks of a transaction are sorted, so the counted ones are a prefix
+            const auto counted = std::ranges::lower_bound(transaction, num_ranks);
+            const auto end = static_cast<size_t>(counted - transaction.begin());
+            for (size_t j = 0; j + 1 < end; ++j) {
+                const auto row = rows[transaction[j]];
+                for (auto l = j + 1; l < end; ++l) {
+                    counts[row + transaction[l]] += weight;
+                }
+            }
+        }
+    }
+
+    auto pair_counts_t::get_num_ranks(const item_counts_t &rank_counts, const size_t min_support) -> size_t {
+        size_t num_ranks = 0;
+        for (const auto &[rank, count]: rank_counts) {
+            if (count >= min_support) {
+                num_ranks = std::max(num_ranks, static_cast<size_t>(rank) + 1);
+            }
+        }
+        return num_ranks;
+    }
 
-        for (const itemset_t &x: itemsets) {
-            for (const itemset_t &y: transactions) {
-                if (x.is_subset(y, compare)) {
-                    ++count[x];
+    auto pair_counts_t::get_frequent_pairs(const size_t min_support) const -> std::tuple<itemsets_t, counts_t> {
+        itemsets_t pairs{};
+        counts_t supports{};
+        for (item_t x = 0; x < num_ranks; ++x) {
+            for (auto y = static_cast<item_t>(x + 1); y < num_ranks; ++y) {
+                if (const auto count = get_count(x, y); count >= min_support) {
+                    pairs.emplace_back(itemset_t{x, y});
+                    supports.push_back(count);
                 }
             }
         }
-        return count;
+        return {std::move(pairs), std::move(supports)};
     }
 
-    auto itemset_counts_t::get_count(const itemset_t &itemset) const -> size_t {
-        return this->contains(itemset) ? this->at(itemset) : 0;
+    auto itemset_counts_t::get_count(const transaction_t &itemset) const -> size_t {
+        const auto index = find(itemset);
+        return index.has_value() ? counts[*index] : 0;
     }
 
-    auto itemset_counts_t::get_support(const itemset_t &itemset, const size_t db_size) const -> float {
+    auto itemset_counts_t::get_support(const transaction_t &itemset, const size_t db_size) const -> float {
         return static_cast<float>(get_count(itemset)) / static_cast<float>(db_size);
     }
 }
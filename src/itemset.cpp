@@ -26,6 +26,7 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 /// THE SOFTWARE.
 
+#include <cstdint>
 #include <ostream>
 #include <functional>
 #include <algorithm>
@@ -36,24 +37,39 @@ namespace fim {
         return i < j;
     }
 
+    auto transaction_t::to_itemset() const -> itemset_t {
+        return itemset_t(begin(), end());
+    }
+
     itemset_t::itemset_t(const item_t &item) {
         emplace_back(item);
     }
 
     itemset_t::itemset_t(const std::initializer_list<item_t> items)
-        : std::vector<item_t>(items) {
+        : small_vector(items) {
     }
 
-    auto itemset_t::is_subset(const itemset_t &superset) const -> bool {
-        return std::ranges::includes(superset, *this);
+    namespace {
+        // The vectorized kernels require itemsets of distinct items sorted in ascending order.
+        auto is_strictly_sorted(const itemset_t &x) -> bool {
+            return std::ranges::adjacent_find(x, std::greater_equal{}) == x.end();
+        }
+
+        auto are_sorted(const itemset_t &x, const itemset_t &y) -> bool {
+            return is_strictly_sorted(x) && is_strictly_sorted(y);
+        }
     }
 
-    auto itemset_t::is_subset(const itemset_t &superset, const item_compare_t &comp) const -> bool {
-        return std::ranges::includes(superset, *this, comp);
+    auto itemset_t::is_subset(const itemset_t &superset) const -> bool {
+        if (are_sorted(*this, superset)) {
+            return simd::includes<item_t>(superset, *this);
+        }
+        return std::ranges::includes(superset, *this);
     }
 
     auto itemset_t::set_union(const itemset_t &y) const -> itemset_t {
         itemset_t z{};
+        z.reserve(size() + y.size());
         std::ranges::set_union(*this, y, std::back_inserter(z));
 
         return z;
@@ -61,8 +77,13 @@ namespace fim {
 
     auto itemset_t::set_difference(const itemset_t &y) const -> itemset_t {
         itemset_t z{};
-        std::ranges::set_difference(*this, y, std::back_inserter(z));
 
+        if (are_sorted(*this, y)) {
+            simd::set_difference<item_t>(*this, y, std::back_inserter(z));
+            return z;
+        }
+
+        std::ranges::set_difference(*this, y, std::back_inserter(z));
         return z;
     }
 
@@ -70,26 +91,21 @@ namespace fim {
         return std::ranges::contains(*this, item);
     }
 
-    auto itemset_t::sort_itemset(const item_compare_t &compare) -> itemset_t & {
-        std::sort(begin(), end(), compare);
-        return *this;
-    }
-
-    auto itemset_t::sort_itemset(const item_compare_t &compare) const -> itemset_t {
-        return itemset_t{*this}.sort_itemset(compare);
-    }
-
     auto itemset_t::add(const item_t &item) -> itemset_t & {
         emplace_back(item);
         return *this;
     }
 
-    auto itemset_hash::operator()(const itemset_t &itemset) const -> std::size_t {
-        std::size_t seed = 0;
+    auto itemset_hash::operator()(const transaction_t &itemset) const -> std::size_t {
+        std::uint64_t hash = itemset.size();
         for (const auto &item: itemset) {
-            seed ^= std::hash<item_t>{}(item) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            hash = (hash ^ item) * 0x9e3779b97f4a7c15;
+            hash ^= hash >> 32;
         }
-        return seed;
+
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+        return hash ^ (hash >> 31);
     }
 
     itemsets_t::itemsets_t(const std::vector<itemset_t> &itemsets)
@@ -114,17 +130,16 @@ namespace fim {
         return std::ranges::contains(*this, itemset);
     }
 
-    auto itemsets_t::sort_each_itemset(const item_compare_t &compare) -> itemsets_t {
-        for (auto &itemset: *this) {
-            itemset.sort_itemset(compare);
-        }
-        return *this;
-    }
-
     auto is_subset(const itemset_t &x, const itemset_t &y) -> bool {
         return x.is_subset(y);
     }
 
+    auto append_to(itemsets_t &itemsets) -> itemset_sink_t {
+        return [&itemsets](const transaction_t &itemset, size_t) {
+            itemsets.emplace_back(itemset.to_itemset());
+        };
+    }
+
     auto set_union(const itemset_t &x, const itemset_t &y) -> itemset_t {
         return x.set_union(y);
     }
@@ -144,20 +159,4 @@ namespace fim {
         os << "}";
         return os;
     }
-
-    auto lexicographical_compare(const itemset_t &x, const itemset_t &y, const item_compare_t &comp) -> bool {
-        auto it_x = x.begin();
-        auto it_y = y.begin();
-
-        for (; it_x != x.end() && it_y != y.end(); ++it_x, ++it_y) {
-            if (comp(*it_x, *it_y)) {
-                return true;
-            }
-
-            if (comp(*it_y, *it_x)) {
-                return false;
-            }
-        }
-        return std::distance(it_x, x.end()) > std::distance(it_y, y.end());
-    }
 }
@@ -0,0 +1,67 @@
+/// @file itemset_trie.cpp
+/// @brief A prefix trie storing the frequent itemsets found by a miner.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include "itemset_trie.h"
+
+namespace fim {
+    auto itemset_trie_t::get_itemset(size_t node) const -> itemset_t {
+        itemset_t itemset{};
+        for (; node != root; node = nodes[node].parent) {
+            itemset.push_back(nodes[node].item);
+        }
+
+        std::ranges::reverse(itemset);
+        return itemset;
+    }
+
+    auto itemset_trie_t::to_itemsets() const -> itemsets_t {
+        itemsets_t itemsets{};
+        itemsets.reserve(nodes.size());
+
+        // a parent is stored before its children, so its itemset is already known
+        for (const auto &[parent, item, support]: nodes) {
+            auto itemset = parent == root ? itemset_t{} : itemsets[parent];
+            itemset.add(item);
+            itemsets.emplace_back(std::move(itemset));
+        }
+        return itemsets;
+    }
+
+    auto trie_builder_t::operator()(const transaction_t &itemset, const size_t support) -> void {
+        assert(not itemset.empty() && itemset.size() <= path.size() + 1);
+        path.resize(itemset.size() - 1);
+
+        const auto parent = path.empty() ? itemset_trie_t::root : path.back();
+        assert(path.empty() || std::ranges::equal(trie.get_itemset(parent), itemset.first(path.size())));
+
+        path.push_back(trie.add(parent, itemset.back(), support));
+    }
+}
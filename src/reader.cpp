@@ -29,6 +29,7 @@
 #include <istream>
 #include <sstream>
 #include <fstream>
+#include <limits>
 #include "reader.h"
 #include "itemset.h"
 
@@ -55,7 +56,10 @@ namespace fim::data {
                 std::string number;
                 while (std::getline(line_stream, number, config.separator)) {
                     const size_t value = std::stoull(number);
-                    itemset.push_back(value);
+                    if (value > std::numeric_limits<item_t>::max()) {
+                        return std::unexpected{io_error_t::VALUE_OUT_OF_RANGE};
+                    }
+                    itemset.push_back(static_cast<item_t>(value));
                 }
             } catch (const std::invalid_argument &) {
                 return std::unexpected{io_error_t::INVALID_FORMAT};
@@ -68,7 +72,7 @@ namespace fim::data {
                 return std::unexpected{io_error_t::INVALID_FORMAT};
             }
 
-            database.push_back(std::move(itemset));
+            database.push_back(itemset);
         }
 
         if (database.empty()) {
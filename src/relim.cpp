@@ -29,37 +29,58 @@
 #include <algorithm>
 #include <ranges>
 #include <cassert>
+#include <functional>
 #include "relim.h"
 
 namespace fim::algorithm::relim {
     using std::views::filter;
     using std::views::transform;
 
+    namespace {
+        template<typename Compare>
+        auto add_itemset_(
+            suffixes_t &suffixes,
+            const itemset_t &itemset,
+            const Compare &compare,
+            const size_t count) -> void {
+            const auto sorted_itemset = itemset.sort_itemset(compare);
+            auto it = suffixes.begin();
+
+            // search for insert position
+            while (it != suffixes.end() && lexicographical_compare(it->itemset, sorted_itemset, compare)) {
+                ++it;
+            }
+
+            if (it != suffixes.end() && it->itemset == sorted_itemset) {
+                // itemset found, increasing counter
+                it->count += count;
+            } else {
+                // itemset haven't been found, insert a new suffix_t element
+                suffixes.insert(it, suffix_t{count, sorted_itemset});
+            }
+        }
+    }
+
     auto suffixes_t::add_itemset(
         const itemset_t &itemset,
         const item_compare_t &compare,
         const size_t count) -> void {
-        const auto sorted_itemset = itemset.sort_itemset(compare);
-        auto it = begin();
-
-        // search for insert position
-        while (it != end() && lexicographical_compare(it->itemset, sorted_itemset, compare)) {
-            ++it;
-        }
+        add_itemset_(*this, itemset, compare, count);
+    }
 
-        if (it != end() && it->itemset == sorted_itemset) {
-            // itemset found, increasing counter
-            it->count += count;
-        } else {
-            // itemset haven't been found, insert a new suffix_t element
-            insert(it, suffix_t{count, sorted_itemset});
-        }
+    auto suffixes_t::add_itemset(
+        const itemset_t &itemset,
+        const rank_compare_t &compare,
+        const size_t count) -> void {
+        add_itemset_(*this, itemset, compare, count);
     }
 
-    conditional_database_t::conditional_database_t(
+    template<typename Compare>
+    basic_conditional_database_t<Compare>::basic_conditional_database_t(
         const itemset_t &freq_items,
-        const item_compare_t &compare) : compare(compare) {
-        static auto to_header_element = [](const item_t &item) { return header_element_t{0, item, suffixes_t{}}; };
+        const Compare &compare,
+        std::pmr::memory_resource *resource) : compare(compare) {
+        auto to_header_element = [&](const item_t &item) { return header_element_t{0, item, suffixes_t{resource}}; };
 
         auto items = freq_items.sort_itemset(compare);
         std::ranges::reverse(items);
@@ -69,37 +90,61 @@ namespace fim::algorithm::relim {
                  | to<header_t>();
     }
 
-    auto conditional_database_t::create_initial_database(
+    namespace {
+        template<typename Compare, typename Database>
+        auto create_initial_database_(
+            const Database &database,
+            const itemset_t &freq_items,
+            const Compare &compare,
+            std::pmr::memory_resource *resource) -> basic_conditional_database_t<Compare> {
+            basic_conditional_database_t<Compare> conditional_db(freq_items, compare, resource);
+
+            auto it = conditional_db.header.rbegin();
+            for_each_transaction(database, [&](const transaction_t &trans, const size_t weight) {
+                const auto &prefix = trans.front();
+                const auto &suffix = trans | drop(1) | to<itemset_t>();
+
+                it = std::find_if(it, conditional_db.header.rend(), [&](const auto &h) {
+                    return h.prefix == prefix;
+                });
+
+                it->count += weight;
+                if (not suffix.empty()) {
+                    it->suffixes.add_itemset(suffix, compare, weight);
+                }
+            });
+            return conditional_db;
+        }
+    }
+
+    template<typename Compare>
+    auto basic_conditional_database_t<Compare>::create_initial_database(
         const database_t &database,
         const itemset_t &freq_items,
-        const item_compare_t &compare) -> conditional_database_t {
-        conditional_database_t conditional_db(freq_items, compare);
-
-        auto it = conditional_db.header.rbegin();
-        for (const itemset_t &trans: database) {
-            const auto &prefix = trans.front();
-            const auto &suffix = trans | drop(1) | to<itemset_t>();
-
-            it = std::find_if(it, conditional_db.header.rend(), [&](const auto &h) {
-                return h.prefix == prefix;
-            });
+        const Compare &compare,
+        std::pmr::memory_resource *resource) -> basic_conditional_database_t {
+        return create_initial_database_(database, freq_items, compare, resource);
+    }
 
-            it->count++;
-            if (not suffix.empty()) {
-                it->suffixes.add_itemset(suffix, compare);
-            }
-        }
-        return conditional_db;
+    template<typename Compare>
+    auto basic_conditional_database_t<Compare>::create_initial_database(
+        const compressed_database_t &database,
+        const itemset_t &freq_items,
+        const Compare &compare,
+        std::pmr::memory_resource *resource) -> basic_conditional_database_t {
+        return create_initial_database_(database, freq_items, compare, resource);
     }
 
-    auto conditional_database_t::create_prefix_database() const -> conditional_database_t {
+    template<typename Compare>
+    auto basic_conditional_database_t<Compare>::create_prefix_database(std::pmr::memory_resource *resource) const
+        -> basic_conditional_database_t {
         const auto &[_, item, suffixes] = header.back();
         const auto items = header
                            | take(header.size() - 1)
                            | transform([](const auto &x) { return x.prefix; })
                            | to<itemset_t>();
 
-        conditional_database_t conditional_db(items, compare);
+        basic_conditional_database_t conditional_db(items, compare, resource);
 
         auto it = conditional_db.header.rbegin();
         for (const auto &[count, itemset]: suffixes) {
@@ -121,7 +166,8 @@ namespace fim::algorithm::relim {
         return conditional_db;
     }
 
-    auto conditional_database_t::eliminate(const conditional_database_t &prefix_db) -> item_t {
+    template<typename Compare>
+    auto basic_conditional_database_t<Compare>::eliminate(const basic_conditional_database_t &prefix_db) -> item_t {
         const auto &prefix = header.back().prefix;
         header.pop_back();
 
@@ -142,50 +188,120 @@ namespace fim::algorithm::relim {
         return prefix;
     }
 
-    auto relim_algorithm(const database_t &database, const size_t min_support) -> itemsets_t {
-        const auto [db, item_counts] = database.transaction_reduction(min_support);
-        return relim_algorithm_({db, item_counts}, min_support);
+    template struct basic_conditional_database_t<item_compare_t>;
+    template struct basic_conditional_database_t<rank_compare_t>;
+
+    namespace {
+        // Mines a reduced database, raw or compressed, whose transactions are sorted lexicographically.
+        template<typename Database>
+        auto relim_(
+            const Database &db,
+            const item_counts_t &item_counts,
+            const size_t min_support,
+            const itemset_sink_t &sink,
+            std::pmr::memory_resource *resource) -> void {
+            // The items of the current prefix; extended before and restored after each recursive call.
+            itemset_t itemset_prefix{};
+
+            const auto relim = [&]<typename Compare>(const Compare &compare) -> void {
+                using func_t = std::function<void(basic_conditional_database_t<Compare> &)>;
+                func_t relim_algorithm_ = [&](basic_conditional_database_t<Compare> &conditional_db) -> void {
+                    while (not conditional_db.header.empty()) {
+                        const auto count = conditional_db.header.back().count;
+                        const auto prefix = conditional_db.header.back().prefix;
+
+                        // the suffix lists of the prefix database are released at once with their arena after it has
+                        // been mined
+                        std::pmr::monotonic_buffer_resource arena{resource};
+                        auto prefix_db = conditional_db.create_prefix_database(&arena);
+                        conditional_db.eliminate(prefix_db);
+
+                        if (count >= min_support) {
+                            itemset_prefix.add(prefix);
+                            sink(itemset_prefix, count);
+
+                            relim_algorithm_(prefix_db);
+                            itemset_prefix.pop_back();
+                        }
+                    }
+                };
+
+                const auto &freq_items = item_counts.get_frequent_items(min_support);
+                auto conditional_db = basic_conditional_database_t<Compare>::create_initial_database(
+                    db, freq_items, compare, resource);
+
+                relim_algorithm_(conditional_db);
+            };
+
+            item_counts.visit_item_compare(relim);
+        }
     }
 
-    auto relim_algorithm_(const database_counts_t &database, const size_t min_support) -> itemsets_t {
+    auto relim_algorithm(const database_t &database, const size_t min_support) -> itemsets_t {
         itemsets_t freq_itemsets{};
+        relim_algorithm(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
+    }
 
-        const auto &[db, item_counts] = database;
-        const auto compare = item_counts.get_item_compare();
-
-        auto combine = [&](const itemset_t &prefix, const itemset_t &suffix) -> itemset_t {
-            itemset_t itemset{};
-            std::ranges::copy(prefix, std::back_inserter(itemset));
-            std::ranges::copy(suffix, std::back_inserter(itemset));
+    auto relim_algorithm_(const database_view_t &database, const size_t min_support) -> itemsets_t {
+        itemsets_t freq_itemsets{};
+        relim_algorithm_(database, min_support, append_to(freq_itemsets));
+        return freq_itemsets;
+    }
 
-            return itemset;
-        };
+    auto relim_trie(const database_t &database, const size_t min_support) -> itemset_trie_t {
+        const auto [db, item_counts, item_ranks] = database.rank_reduction(
+            min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
 
-        auto insert_itemset = [&](const itemset_t &itemset, size_t) -> itemset_t {
-            freq_itemsets.emplace_back(itemset);
-            return itemset;
-        };
+        itemset_trie_t trie{};
+        relim_trie_({db, item_counts}, min_support, trie);
+        return item_ranks.to_items(std::move(trie));
+    }
 
-        using func_t = std::function<void(const itemset_t &, conditional_database_t &)>;
-        func_t relim_algorithm_ = [&](const itemset_t &itemset_prefix, conditional_database_t &conditional_db) -> void {
-            while (not conditional_db.header.empty()) {
-                const auto [count, prefix, suffixes] = conditional_db.header.back();
-                const auto new_prefix = combine(itemset_t{itemset_prefix}, itemset_t{prefix});
+    auto relim_trie_(const database_view_t &database, const size_t min_support, itemset_trie_t &trie) -> void {
+        trie_builder_t builder{trie};
+        relim_algorithm_(database, min_support, std::ref(builder));
+    }
 
-                auto prefix_db = conditional_db.create_prefix_database();
-                conditional_db.eliminate(prefix_db);
+    auto relim_algorithm(
+        const database_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto [db, item_counts, item_ranks] = database.rank_reduction(
+            min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
+        relim_algorithm_({db, item_counts}, min_support, item_ranks.to_items(sink), resource);
+    }
 
-                if (count >= min_support) {
-                    insert_itemset(new_prefix, count);
-                    relim_algorithm_(new_prefix, prefix_db);
-                }
-            }
-        };
+    auto relim_algorithm_(
+        const database_view_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto &[db, item_counts] = database;
+        relim_(db, item_counts, min_support, sink, resource);
+    }
 
-        const auto &freq_items = item_counts.get_frequent_items(min_support);
-        auto conditional_db = conditional_database_t::create_initial_database(db, freq_items, compare);
+    auto relim_compressed(
+        database_t &&database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        auto [db, item_counts, item_ranks] = std::move(database).rank_reduction(
+            min_support, {.collapse_duplicates = true, .sort_algorithm = sort_algorithm_t::RADIX});
+
+        // only the compressed transactions are kept while mining
+        const compressed_database_t compressed{db};
+        db = database_t{};
+        relim_compressed_({compressed, item_counts}, min_support, item_ranks.to_items(sink), resource);
+    }
 
-        relim_algorithm_({}, conditional_db);
-        return freq_itemsets;
+    auto relim_compressed_(
+        const compressed_database_view_t &database,
+        const size_t min_support,
+        const itemset_sink_t &sink,
+        std::pmr::memory_resource *resource) -> void {
+        const auto &[db, item_counts] = database;
+        relim_(db, item_counts, min_support, sink, resource);
     }
 }
@@ -41,15 +41,8 @@ using std::ranges::views::transform;
 using std::ranges::views::join_with;
 
 namespace fim::data {
-    auto to_csv(
-        std::ostream &os,
-        const write_input_t &input,
-        const write_csv_config_t &config) -> write_result_t {
-        // set formatting style
-        std::cout << std::fixed << std::setprecision(2);
-        const auto &[itemsets, support_values] = input;
-
-        auto write_header = [&] {
+    namespace {
+        auto write_header(std::ostream &os, const write_csv_config_t &config) -> void {
             const std::vector columns{"length"sv, "itemset"sv, "support"sv};
             const auto header = columns | std::views::join_with(config.separator);
 
@@ -58,9 +51,13 @@ namespace fim::data {
             }
 
             os << std::endl;
-        };
+        }
 
-        auto write_itemset = [&](const itemset_t &itemset, const float &support) {
+        auto write_itemset(
+            std::ostream &os,
+            const itemset_t &itemset,
+            const float &support,
+            const write_csv_config_t &config) -> void {
             constexpr auto space = " "sv;
             os << itemset.size() << config.separator;
             std::ranges::for_each(itemset
@@ -68,18 +65,46 @@ namespace fim::data {
                                   | join_with(space), [&](const auto &item) { os << item; });
 
             os << config.separator << support << std::endl;
-        };
+        }
+    }
+
+    auto to_csv(
+        std::ostream &os,
+        const write_input_t &input,
+        const write_csv_config_t &config) -> write_result_t {
+        // set formatting style
+        std::cout << std::fixed << std::setprecision(2);
+        const auto &[itemsets, support_values] = input;
 
         if (itemsets.empty()) {
             return std::unexpected{io_error_t::EMPTY_ERROR};
         }
 
         if (config.with_header) {
-            write_header();
+            write_header(os, config);
         }
 
         for (const auto &&[itemset, support]: std::ranges::views::zip(itemsets, support_values)) {
-            write_itemset(itemset, support);
+            write_itemset(os, itemset, support, config);
+        }
+        return write_result_t{};
+    }
+
+    auto to_csv(
+        std::ostream &os,
+        const itemset_trie_t &trie,
+        const size_t num_transactions,
+        const write_csv_config_t &config) -> write_result_t {
+        if (trie.empty()) {
+            return std::unexpected{io_error_t::EMPTY_ERROR};
+        }
+
+        if (config.with_header) {
+            write_header(os, config);
+        }
+
+        for (const auto &[itemset, support]: trie) {
+            write_itemset(os, itemset, static_cast<float>(support) / static_cast<float>(num_transactions), config);
         }
         return write_result_t{};
     }
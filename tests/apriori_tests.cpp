@@ -29,6 +29,8 @@
 #include <gtest/gtest.h>
 #include <ranges>
 #include "apriori.h"
+#include "eclat.h"
+#include "fp_growth.h"
 
 using namespace fim;
 using namespace fim::algorithm::apriori;
@@ -99,3 +101,114 @@ TEST_F(AprioriTests, GenerateCandidatesTest) {
     EXPECT_TRUE(candidates.contains({2, 3, 6}));
     EXPECT_TRUE(candidates.contains({2, 3, 7}));
 }
+
+TEST_F(AprioriTests, GenerateSortedCandidatesTest) {
+    const itemsets_t itemsets = {{1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}};
+    const itemsets_t expected = {{1, 2, 3}, {1, 2, 4}, {1, 3, 4}, {2, 3, 4}};
+
+    // the candidates are sorted in lexicographical order, also if the itemsets of the level are not
+    EXPECT_EQ(generate_candidates(itemsets, 3, rank_compare_t{}), expected);
+
+    const itemsets_t shuffled = {{2, 4}, {1, 3}, {3, 4}, {1, 2}, {2, 3}, {1, 4}};
+    EXPECT_EQ(generate_candidates(shuffled, 3, rank_compare_t{}), expected);
+}
+
+TEST_F(AprioriTests, GenerateCandidatesWithInfrequentSubsetTest) {
+    // {1, 2, 3, 4} is not a candidate, since its subset {2, 3, 4} is not frequent
+    const itemsets_t itemsets = {{1, 2, 3}, {1, 2, 4}, {1, 2, 5}, {1, 3, 4}, {1, 3, 5}, {1, 4, 5}, {2, 3, 5}, {2, 4, 5},
+                                 {3, 4, 5}};
+    const auto candidates = generate_candidates(itemsets, 4, rank_compare_t{});
+
+    EXPECT_EQ(candidates, itemsets_t({{1, 2, 3, 5}, {1, 2, 4, 5}, {1, 3, 4, 5}}));
+}
+
+TEST_F(AprioriTests, CandidateTrieTest) {
+    const auto [db, item_counts] = get_database().transaction_reduction(min_support());
+    const auto compare = item_counts.get_item_compare();
+
+    // the candidates need not be in lexicographical order
+    itemsets_t candidates{};
+    const auto items = item_counts.get_frequent_items(min_support()).sort_itemset(compare);
+    for (size_t i = items.size(); i-- > 0;) {
+        for (size_t j = i + 1; j < items.size(); ++j) {
+            for (size_t l = j + 1; l < items.size(); ++l) {
+                candidates.emplace_back(itemset_t{items[i], items[j], items[l]});
+            }
+        }
+    }
+
+    const candidate_trie_t trie{candidates, compare};
+    EXPECT_EQ(trie.depth(), 3);
+    EXPECT_EQ(trie.items.front().size(), items.size() - 2);
+
+    const auto supports = trie.get_supports(db, compare);
+    ASSERT_EQ(supports.size(), candidates.size());
+    for (size_t k = 0; k < candidates.size(); ++k) {
+        size_t support = 0;
+        for (size_t i = 0; i < db.size(); ++i) {
+            support += candidates[k].is_subset(db[i], compare) ? db.get_weight(i) : 0;
+        }
+        EXPECT_EQ(supports[k], support);
+    }
+}
+
+TEST_F(AprioriTests, CandidateTrieTrimTest) {
+    const auto [db, item_counts] = get_database().transaction_reduction(min_support());
+    const auto compare = item_counts.get_item_compare();
+    const auto items = item_counts.get_frequent_items(min_support()).sort_itemset(compare);
+
+    auto get_support = [&](const database_t &database, const itemset_t &itemset) {
+        size_t support = 0;
+        for (size_t i = 0; i < database.size(); ++i) {
+            support += itemset.is_subset(database[i], compare) ? database.get_weight(i) : 0;
+        }
+        return support;
+    };
+
+    // the frequent pairs of the items
+    itemsets_t candidates{};
+    for (size_t i = 0; i < items.size(); ++i) {
+        for (size_t j = i + 1; j < items.size(); ++j) {
+            candidates.emplace_back(itemset_t{items[i], items[j]});
+        }
+    }
+    prune(candidates, db, min_support(), compare);
+    ASSERT_FALSE(candidates.empty());
+
+    database_t trimmed{};
+    const candidate_trie_t trie{candidates, compare};
+    const auto supports = trie.get_supports(db, compare, trimmed);
+    EXPECT_EQ(supports, trie.get_supports(db, compare));
+    EXPECT_LT(trimmed.items.size(), db.items.size());
+
+    // the trimmed database keeps the supports of all candidates of the next level
+    const auto next_candidates = generate_candidates(candidates, 3, compare);
+    ASSERT_FALSE(next_candidates.empty());
+    for (const auto &candidate: next_candidates) {
+        EXPECT_EQ(get_support(trimmed, candidate), get_support(db, candidate));
+    }
+    for (size_t i = 0; i < trimmed.size(); ++i) {
+        EXPECT_GT(trimmed[i].size(), 2);
+    }
+}
+
+TEST_F(AprioriTests, DatabaseRankedAtLowerSupportTest) {
+    // the ranks ascend by support, so the frequent ranks are the greatest ones of a database ranked at a lower
+    // support than the one it is mined at
+    const auto [db, rank_counts, item_ranks] = get_database().rank_reduction(1, {.collapse_duplicates = true});
+    ASSERT_TRUE(rank_counts.ranked);
+    ASSERT_LT(rank_counts.get_frequent_items(min_support()).size(), rank_counts.size());
+
+    auto sorted = [](itemsets_t itemsets) {
+        for (auto &itemset: itemsets) {
+            std::ranges::sort(itemset);
+        }
+        std::ranges::sort(itemsets);
+        return itemsets;
+    };
+
+    const auto expected = sorted(fim::algorithm::fp_growth::fp_growth_algorithm_({db, rank_counts}, min_support()));
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(sorted(apriori_algorithm_({db, rank_counts}, min_support())), expected);
+    EXPECT_EQ(sorted(fim::algorithm::eclat::eclat_algorithm_({db, rank_counts}, min_support())), expected);
+}
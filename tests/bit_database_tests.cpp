@@ -0,0 +1,102 @@
+/// @file bit_database_tests.cpp
+/// @brief Unit test for the bit matrix database.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2023 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <variant>
+#include "database.h"
+#include "bit_database.h"
+
+using namespace fim;
+
+class BitDatabaseTests : public testing::Test {
+protected:
+    static database_t get_database() {
+        return database_t{
+            {3, 4, 2, 5, 6, 7},
+            {1, 3, 4, 6},
+            {5, 1, 4, 6, 8, 7},
+            {1, 4},
+            {1, 4, 5},
+            {7, 1},
+            {2, 3, 4, 1, 5, 6, 7},
+            {8},
+            {1, 3, 2, 5, 6, 7},
+            {8, 3, 4, 6, 2, 7, 1}
+        };
+    }
+};
+
+TEST_F(BitDatabaseTests, IsSubsetTest) {
+    const auto x = bit_database_t<2>::to_bitset(itemset_t{1, 70});
+    const auto y = bit_database_t<2>::to_bitset(itemset_t{1, 5, 70, 127});
+
+    EXPECT_EQ(x[0], 0b10);
+    EXPECT_EQ(x[1], 0b1000000);
+    EXPECT_TRUE(is_subset(x, y));
+    EXPECT_FALSE(is_subset(y, x));
+    EXPECT_TRUE(is_subset(x, x));
+}
+
+TEST_F(BitDatabaseTests, GetSupportTest) {
+    const auto &[db, counts, ranks] = get_database().rank_reduction(4, {.collapse_duplicates = true});
+    const auto bits = bit_database_t<1>{db};
+
+    ASSERT_EQ(bits.size(), db.size());
+
+    // the supports equal the ones counted by merging the items
+    itemsets_t itemsets{};
+    const auto last = static_cast<item_t>(ranks.size() - 1);
+    for (item_t i = 0; i < ranks.size(); ++i) {
+        for (item_t j = i + 1; j < ranks.size(); ++j) {
+            itemsets.emplace_back(itemset_t{i, j});
+            if (j < last) {
+                itemsets.emplace_back(itemset_t{i, j, last});
+            }
+        }
+    }
+
+    const auto supports = bits.get_supports(itemsets);
+    for (size_t k = 0; k < itemsets.size(); ++k) {
+        size_t support = 0;
+        for (size_t i = 0; i < db.size(); ++i) {
+            support += itemsets[k].is_subset(db[i], rank_compare_t{}) ? db.get_weight(i) : 0;
+        }
+        EXPECT_EQ(supports[k], support);
+    }
+
+    // the rank of item 1, which is contained in 8 transactions
+    EXPECT_EQ(bits.get_support(itemset_t{static_cast<item_t>(ranks.get_rank(1))}), 8);
+    EXPECT_EQ(bits.get_support(itemset_t{64}), 0);
+}
+
+TEST_F(BitDatabaseTests, CreateBitMatrixTest) {
+    EXPECT_TRUE(std::holds_alternative<bit_database_t<1> >(create_bit_matrix(database_t{{0, 63}})));
+    EXPECT_TRUE(std::holds_alternative<bit_database_t<2> >(create_bit_matrix(database_t{{0, 64}})));
+    EXPECT_TRUE(std::holds_alternative<bit_database_t<4> >(create_bit_matrix(database_t{{255}})));
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(create_bit_matrix(database_t{{256}})));
+}
@@ -0,0 +1,184 @@
+/// @file compressed_database_tests.cpp
+/// @brief Unit tests for the prefix-compressed database.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <utility>
+#include "database.h"
+#include "compressed_database.h"
+#include "item_counts.h"
+#include "fp_tree.h"
+#include "fp_growth.h"
+#include "relim.h"
+
+using namespace fim;
+
+class CompressedDatabaseTests : public testing::Test {
+protected:
+    static size_t min_support() { return 2; }
+
+    static auto get_database() -> database_t {
+        return database_t{
+            {'a', 'd'},
+            {'a', 'c', 'd', 'e'},
+            {'b', 'd'},
+            {'b', 'c', 'd'},
+            {'b', 'c', 'f'},
+            {'a', 'b', 'd'},
+            {'b', 'd', 'e'},
+            {'b', 'c', 'd', 'e'},
+            {'g', 'b', 'c'},
+            {'a', 'b', 'd'}
+        };
+    }
+
+    static auto get_ranked_database() -> database_t {
+        auto [db, counts, ranks] = get_database().rank_reduction(min_support(), {.collapse_duplicates = true});
+        db.radix_sort_lexicographically();
+        return db;
+    }
+};
+
+TEST_F(CompressedDatabaseTests, EmptyDatabaseTest) {
+    const compressed_database_t compressed{database_t{}};
+
+    EXPECT_TRUE(compressed.empty());
+    EXPECT_EQ(compressed.encoded_size(), 0);
+    EXPECT_FALSE(compressed.decoder().next());
+    EXPECT_EQ(compressed.to_database(), database_t{});
+}
+
+TEST_F(CompressedDatabaseTests, RoundTripTest) {
+    // the unsorted database contains descending items, encoded as negative differences
+    const auto db = get_database();
+    const compressed_database_t compressed{db};
+
+    EXPECT_EQ(compressed.size(), db.size());
+    EXPECT_FALSE(compressed.is_weighted());
+    EXPECT_EQ(compressed.to_database(), db);
+}
+
+TEST_F(CompressedDatabaseTests, WeightedRoundTripTest) {
+    const auto db = get_ranked_database();
+    ASSERT_TRUE(db.is_weighted());
+
+    const compressed_database_t compressed{db};
+    EXPECT_TRUE(compressed.is_weighted());
+    EXPECT_EQ(compressed.to_database(), db);
+}
+
+TEST_F(CompressedDatabaseTests, SharedPrefixTest) {
+    const database_t db{{1, 2, 3}, {1, 2, 4}, {1, 5}, {6}, {6}};
+    const compressed_database_t compressed{db};
+
+    auto decoder = compressed.decoder();
+    std::vector<size_t> prefix_sizes{};
+    while (decoder.next()) {
+        prefix_sizes.push_back(decoder.prefix_size);
+    }
+    EXPECT_EQ(prefix_sizes, std::vector<size_t>({0, 2, 1, 0, 1}));
+
+    // each stored item is a single byte, each transaction adds two bytes of lengths
+    EXPECT_EQ(compressed.encoded_size(), 2 * db.size() + 6);
+}
+
+TEST_F(CompressedDatabaseTests, BuildFpTreeTest) {
+    const auto db = get_ranked_database();
+    const compressed_database_t compressed{db};
+    const auto freq_items = db.get_item_counts().get_frequent_items(min_support());
+
+    const auto &root = fp_tree::build_fp_tree(db, freq_items);
+    const auto &compressed_root = fp_tree::build_fp_tree(compressed, freq_items);
+
+    for (const auto &item: freq_items) {
+        EXPECT_EQ(get_item_frequency(compressed_root, item), get_item_frequency(root, item));
+    }
+}
+
+TEST_F(CompressedDatabaseTests, CreateInitialDatabaseTest) {
+    using conditional_database_t = algorithm::relim::conditional_database_t;
+
+    const auto &[db, item_counts] = get_database().transaction_reduction(min_support());
+    const auto compare = item_counts.get_item_compare();
+    const auto &freq_items = item_counts.get_frequent_items(min_support());
+
+    const auto &expected = conditional_database_t::create_initial_database(db, freq_items, compare);
+    const auto &actual = conditional_database_t::create_initial_database(
+        compressed_database_t{db}, freq_items, compare);
+
+    ASSERT_EQ(actual.header.size(), expected.header.size());
+    for (size_t i = 0; i < expected.header.size(); ++i) {
+        EXPECT_EQ(actual.header[i].prefix, expected.header[i].prefix);
+        EXPECT_EQ(actual.header[i].count, expected.header[i].count);
+        EXPECT_EQ(actual.header[i].suffixes.size(), expected.header[i].suffixes.size());
+    }
+}
+
+TEST_F(CompressedDatabaseTests, CreateItemsetCountsTest) {
+    const auto db = get_ranked_database();
+    const compressed_database_t compressed{db};
+
+    itemsets_t itemsets{};
+    for (item_t i = 0; i < 4; ++i) {
+        for (item_t j = i + 1; j < 4; ++j) {
+            itemsets.emplace_back(itemset_t{i, j});
+        }
+    }
+
+    const auto &expected = itemset_counts_t::create_itemset_counts(db, itemsets, rank_compare_t{});
+    const auto &actual = itemset_counts_t::create_itemset_counts(compressed, itemsets, rank_compare_t{});
+    EXPECT_EQ(actual.get_counts(itemsets), expected.get_counts(itemsets));
+}
+
+TEST_F(CompressedDatabaseTests, MineCompressedTest) {
+    using result_t = std::vector<std::pair<itemset_t, size_t> >;
+
+    auto collect = [](result_t &result) -> itemset_sink_t {
+        return [&result](const transaction_t &itemset, const size_t support) {
+            auto items = itemset.to_itemset();
+            std::ranges::sort(items);
+            result.emplace_back(std::move(items), support);
+        };
+    };
+
+    result_t expected{};
+    algorithm::fp_growth::fp_growth_algorithm(get_database(), min_support(), collect(expected));
+    std::ranges::sort(expected);
+    ASSERT_FALSE(expected.empty());
+
+    // the compressing miners keep only the compressed transactions while mining
+    result_t fp_growth{};
+    algorithm::fp_growth::fp_growth_compressed(get_database(), min_support(), collect(fp_growth));
+    std::ranges::sort(fp_growth);
+    EXPECT_EQ(fp_growth, expected);
+
+    result_t relim{};
+    algorithm::relim::relim_compressed(get_database(), min_support(), collect(relim));
+    std::ranges::sort(relim);
+    EXPECT_EQ(relim, expected);
+}
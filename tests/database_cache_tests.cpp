@@ -0,0 +1,128 @@
+/// @file database_cache_tests.cpp
+/// @brief Unit tests for the database cache.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2024 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include "database_cache.h"
+
+using namespace fim;
+using namespace fim::algorithm;
+
+class DatabaseCacheTests : public testing::TestWithParam<algorithm_t> {
+protected:
+    static auto get_database() -> database_t {
+        return database_t{
+            {'a', 'd'},
+            {'a', 'c', 'd', 'e'},
+            {'b', 'd'},
+            {'b', 'c', 'd'},
+            {'b', 'c', 'f'},
+            {'a', 'b', 'd'},
+            {'b', 'd', 'e'},
+            {'b', 'c', 'd', 'e'},
+            {'g', 'b', 'c'},
+            {'a', 'b', 'd'}
+        };
+    }
+
+    // The frequent itemsets, each one sorted, with their support.
+    using result_t = std::map<std::vector<item_t>, size_t>;
+
+    static auto collect(result_t &result) -> itemset_sink_t {
+        return [&result](const transaction_t &itemset, const size_t support) {
+            auto items = std::vector<item_t>(itemset.begin(), itemset.end());
+            std::ranges::sort(items);
+            result[items] = support;
+        };
+    }
+
+    // Mines the database without the cache.
+    static auto mine(const database_t &database, const algorithm_t algorithm, const size_t min_support) {
+        const auto [db, item_counts] = database.transaction_reduction(min_support);
+
+        result_t result{};
+        get_sink_algorithm(algorithm)({db, item_counts}, min_support, collect(result),
+                                      std::pmr::get_default_resource());
+        return result;
+    }
+};
+
+TEST_F(DatabaseCacheTests, CachesRepresentationsTest) {
+    database_cache_t cache{get_database()};
+
+    const auto &ranked_db = cache.get_ranked_database(2);
+    const auto &vertical_db = cache.get_vertical_database(2);
+    const auto &root = cache.get_fp_tree(2);
+    EXPECT_EQ(cache.num_cached(), 1);
+
+    // the representations are built once per minimum support
+    EXPECT_EQ(&cache.get_ranked_database(2), &ranked_db);
+    EXPECT_EQ(&cache.get_vertical_database(2), &vertical_db);
+    EXPECT_EQ(cache.get_fp_tree(2), root);
+
+    EXPECT_NE(&cache.get_ranked_database(3), &ranked_db);
+    EXPECT_EQ(cache.num_cached(), 2);
+}
+
+TEST_F(DatabaseCacheTests, InvalidateOnUpdateTest) {
+    database_cache_t cache{get_database()};
+    EXPECT_EQ(std::get<0>(cache.get_ranked_database(2)).size(), 8);
+
+    cache.push_back(itemset_t{'a', 'b', 'c'});
+    EXPECT_EQ(cache.num_cached(), 0);
+    EXPECT_EQ(std::get<0>(cache.get_ranked_database(2)).size(), 9);
+
+    cache.update([](database_t &database) { database.clear(); });
+    EXPECT_EQ(cache.num_cached(), 0);
+    EXPECT_TRUE(std::get<0>(cache.get_ranked_database(2)).empty());
+}
+
+TEST_P(DatabaseCacheTests, MineTest) {
+    const auto algorithm = GetParam();
+    database_cache_t cache{get_database()};
+
+    for (const size_t min_support: {2, 3, 2}) {
+        result_t result{};
+        cache.mine(algorithm, min_support, collect(result));
+        EXPECT_EQ(result, mine(cache.get_database(), algorithm, min_support));
+    }
+    EXPECT_EQ(cache.num_cached(), 2);
+
+    // the cache mines the changed database
+    cache.push_back(itemset_t{'b', 'c', 'e'});
+    result_t result{};
+    cache.mine(algorithm, 3, collect(result));
+    EXPECT_EQ(result, mine(cache.get_database(), algorithm, 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DatabaseCacheTests,
+    DatabaseCacheTests,
+    testing::Values(algorithm_t::APRIORI, algorithm_t::FP_GROWTH, algorithm_t::RELIM, algorithm_t::ECLAT));
@@ -27,6 +27,7 @@
 /// THE SOFTWARE.
 
 #include <gtest/gtest.h>
+#include <random>
 #include <ranges>
 #include "itemset.h"
 #include "database.h"
@@ -91,3 +92,187 @@ TEST_F(DatabaseTests, GetFrequentItemsTest) {
 
     EXPECT_EQ(freq_items, itemset_t({2, 3, 5, 6, 7, 4, 1}));
 }
+
+TEST_F(DatabaseTests, RankReductionTest) {
+    constexpr auto min_support = 4;
+    const auto &[db, counts, ranks] = get_database().rank_reduction(min_support);
+
+    // ranks: 2 < 3 < 5 < 6 < 7 < 4 < 1 (ascending support)
+    ASSERT_EQ(ranks.size(), 7);
+    EXPECT_EQ(ranks.items, itemset_t({2, 3, 5, 6, 7, 4, 1}));
+    EXPECT_EQ(ranks.counts, counts_t({4, 5, 5, 6, 6, 7, 8}));
+    EXPECT_FALSE(ranks.contains(8));
+
+    ASSERT_EQ(counts.size(), 7);
+    EXPECT_TRUE(counts.ranked);
+    EXPECT_EQ(counts.at(0), 4);
+    EXPECT_EQ(counts.at(6), 8);
+
+    ASSERT_EQ(db.size(), 9);
+
+    EXPECT_EQ(db[0], itemset_t({0, 1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(db[1], itemset_t({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(db[4], itemset_t({1, 3, 5, 6}));
+    EXPECT_EQ(db[8], itemset_t({5, 6}));
+
+    for (size_t i = 0; i < db.size(); ++i) {
+        const auto &[reduced_db, _] = get_database().reduce_database(min_support);
+        EXPECT_EQ(ranks.to_items(db[i]), reduced_db[i]);
+    }
+}
+
+TEST_F(DatabaseTests, CompressedRowStorageTest) {
+    auto db = database_t{{3, 4}, {1}, {2, 5, 6}};
+
+    EXPECT_EQ(db.size(), 3);
+    EXPECT_EQ(db.items, (std::vector<item_t>{3, 4, 1, 2, 5, 6}));
+    EXPECT_EQ(db.offsets, (std::vector<size_t>{0, 2, 3, 6}));
+
+    db.push_back(itemset_t{7, 8});
+    EXPECT_EQ(db.size(), 4);
+    EXPECT_EQ(db.back(), itemset_t({7, 8}));
+    EXPECT_EQ(db[2], itemset_t({2, 5, 6}));
+
+    const auto sizes = db
+                       | transform([](const transaction_t &trans) { return trans.size(); })
+                       | std::ranges::to<std::vector<size_t> >();
+    EXPECT_EQ(sizes, (std::vector<size_t>{2, 1, 3, 2}));
+
+    db.clear();
+    EXPECT_TRUE(db.empty());
+    EXPECT_TRUE(db.items.empty());
+
+    db.push_back(itemset_t{1, 2}, 3);
+    db.push_back(itemset_t{3});
+    EXPECT_EQ(db.weights, (std::vector<size_t>{3, 1}));
+}
+
+TEST_F(DatabaseTests, CollapseDuplicatesTest) {
+    auto db = database_t{{1, 2}, {1, 2}, {1, 2, 3}, {4}, {4}, {4}};
+
+    EXPECT_FALSE(db.is_weighted());
+    db.collapse_duplicates();
+
+    ASSERT_EQ(db.size(), 3);
+    EXPECT_EQ(db[0], itemset_t({1, 2}));
+    EXPECT_EQ(db[1], itemset_t({1, 2, 3}));
+    EXPECT_EQ(db[2], itemset_t{4});
+    EXPECT_EQ(db.weights, (std::vector<size_t>{2, 1, 3}));
+    EXPECT_EQ(db.get_total_weight(), 6);
+
+    const auto counts = db.get_item_counts();
+    EXPECT_EQ(counts.at(1), 3);
+    EXPECT_EQ(counts.at(3), 1);
+    EXPECT_EQ(counts.at(4), 3);
+}
+
+TEST_F(DatabaseTests, WeightedReductionTest) {
+    constexpr auto min_support = 4;
+    const auto &[db, counts] = get_database().reduce_database(min_support);
+    const auto &[weighted_db, weighted_counts] = get_database().reduce_database(
+        min_support, {.collapse_duplicates = true});
+
+    EXPECT_EQ(weighted_counts, counts);
+    EXPECT_EQ(weighted_db.get_total_weight(), db.size());
+
+    for (size_t i = 0, j = 0; i < weighted_db.size(); j += weighted_db.get_weight(i++)) {
+        EXPECT_EQ(weighted_db[i], db[j]);
+    }
+}
+
+TEST_F(DatabaseTests, InPlaceReductionTest) {
+    constexpr auto min_support = 4;
+    const auto &[expected_db, expected_counts] = get_database().transaction_reduction(min_support);
+
+    auto database = get_database();
+    const auto &[db, counts] = database.reduce_database(min_support);
+
+    EXPECT_EQ(&db, &database);
+    EXPECT_EQ(db, expected_db);
+    EXPECT_EQ(counts, expected_counts);
+
+    database_t buffer{{42}};
+    const auto original_db = get_database();
+    const auto &[buffer_db, buffer_counts] = original_db.transaction_reduction(min_support, buffer);
+
+    EXPECT_EQ(&buffer_db, &buffer);
+    EXPECT_EQ(buffer_db, expected_db);
+    EXPECT_EQ(buffer_counts, expected_counts);
+    EXPECT_EQ(original_db, get_database());
+}
+
+TEST_F(DatabaseTests, InPlaceRankReductionTest) {
+    constexpr auto min_support = 4;
+    const auto original_db = get_database();
+    const auto &[expected_db, expected_counts, expected_ranks] = original_db.rank_reduction(min_support);
+
+    auto database = get_database();
+    const auto &[db, counts, ranks] = std::move(database).rank_reduction(min_support);
+
+    EXPECT_EQ(db, expected_db);
+    EXPECT_EQ(counts, expected_counts);
+    EXPECT_EQ(ranks.items, expected_ranks.items);
+}
+
+TEST_F(DatabaseTests, RadixReductionTest) {
+    constexpr auto min_support = 4;
+    constexpr auto config = reduce_config_t{.sort_algorithm = sort_algorithm_t::RADIX};
+
+    const auto &[expected_db, expected_counts] = get_database().reduce_database(min_support);
+    const auto &[db, counts] = get_database().reduce_database(min_support, config);
+
+    EXPECT_EQ(db, expected_db);
+    EXPECT_EQ(counts, expected_counts);
+
+    const auto &[expected_ranked_db, expected_rank_counts, expected_ranks] = get_database().rank_reduction(min_support);
+    const auto &[ranked_db, rank_counts, ranks] = get_database().rank_reduction(min_support, config);
+
+    EXPECT_EQ(ranked_db, expected_ranked_db);
+    EXPECT_EQ(rank_counts, expected_rank_counts);
+}
+
+TEST_F(DatabaseTests, RadixSortTest) {
+    // a database large enough to be sorted by several threads, with a few transactions longer than
+    // the ones sorted by insertion sort and many sharing a prefix
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<item_t> rank_distribution{0, 999};
+    std::geometric_distribution<size_t> size_distribution{0.1};
+
+    database_t database{};
+    for (size_t i = 0; i < 20000; ++i) {
+        itemset_t transaction{};
+        const auto size = i % 1000 == 0 ? 500 : size_distribution(generator);
+        for (size_t j = 0; j < size; ++j) {
+            transaction.push_back(i % 3 == 0 ? j : rank_distribution(generator));
+        }
+        std::ranges::shuffle(transaction, generator);
+        database.push_back(transaction, i % 7 + 1);
+    }
+
+    // the order of identical transactions is unspecified, so their weights are compared in total
+    auto expected_db = database;
+    expected_db.sort_lexicographically(rank_compare_t{}).collapse_duplicates();
+
+    for (const auto num_threads: {1, 4}) {
+        auto db = database;
+        db.radix_sort_lexicographically(num_threads).collapse_duplicates();
+        EXPECT_EQ(db, expected_db);
+    }
+}
+
+TEST_F(DatabaseTests, GrayCodeSortTest) {
+    // the ranks ascend by support, so the pattern is formed by the two highest ranks (3 as the highest bit);
+    // in Gray code order the patterns are 00, 01, 11, 10
+    database_t db{{0, 3}, {1}, {0, 1}, {2}, {0}, {1, 2}, {2, 3}, {0, 1, 2}};
+    db.gray_code_sort(2);
+
+    EXPECT_EQ(db, database_t({{1}, {0, 1}, {0}, {2}, {1, 2}, {0, 1, 2}, {2, 3}, {0, 3}}));
+
+    // the reordering keeps the transactions
+    auto ranked_db = std::get<0>(get_database().rank_reduction(1));
+    auto reordered_db = ranked_db;
+    reordered_db.gray_code_sort();
+
+    EXPECT_NE(reordered_db, ranked_db);
+    EXPECT_EQ(reordered_db.sort_lexicographically(rank_compare_t{}), ranked_db);
+}
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <ranges>
 #include "fp_growth.h"
+#include "item_counts.h"
 
 using namespace fim;
 using namespace fim::algorithm::fp_growth;
@@ -66,13 +67,14 @@ TEST_F(FPGrowthTests, ConditionalTransactions1Test) {
     const auto &root = build_fp_tree(db, freq_items);
     const auto &trans = conditional_transactions(root, 7, get_compare());
 
-    ASSERT_EQ(trans.size(), 6);
+    // each path is added once, weighted by the frequency of its node
+    ASSERT_EQ(trans.size(), 4);
     EXPECT_EQ(trans[0], (itemset_t{1, 4, 6}));
-    EXPECT_EQ(trans[1], (itemset_t{1, 4, 6}));
-    EXPECT_EQ(trans[2], (itemset_t{1, 4, 6}));
-    EXPECT_EQ(trans[3], (itemset_t{{1, 6}}));
-    EXPECT_EQ(trans[4], itemset_t{1});
-    EXPECT_EQ(trans[5], (itemset_t{{4, 6}}));
+    EXPECT_EQ(trans[1], (itemset_t{{1, 6}}));
+    EXPECT_EQ(trans[2], itemset_t{1});
+    EXPECT_EQ(trans[3], (itemset_t{{4, 6}}));
+    EXPECT_EQ(trans.get_weight(0), 3);
+    EXPECT_EQ(trans.get_total_weight(), 6);
 }
 
 TEST_F(FPGrowthTests, ConditionalTransactions2Test) {
@@ -88,3 +90,20 @@ TEST_F(FPGrowthTests, ConditionalTransactions2Test) {
     EXPECT_EQ(trans[2], (itemset_t{1, 3, 5, 6, 7}));
     EXPECT_EQ(trans[3], (itemset_t{3, 4, 5, 6, 7}));
 }
+
+TEST_F(FPGrowthTests, FPGrowthTrieTest) {
+    const auto [db, item_counts] = get_database().transaction_reduction(min_support());
+    const auto compare = item_counts.get_item_compare();
+
+    const auto &trie = fp_growth_trie(db, min_support());
+    ASSERT_EQ(trie.size(), 35);
+
+    // the trie holds the same itemsets as the flat result together with their support
+    const auto &freq_items = trie.to_itemsets().sort_each_itemset(compare);
+    const auto &counts = itemset_counts_t::create_itemset_counts(db, freq_items, compare);
+
+    EXPECT_EQ(freq_items.size(), fp_growth_algorithm(db, min_support()).size());
+    for (const auto &[itemset, support]: trie) {
+        EXPECT_EQ(counts.get_count(itemset.sort_itemset(compare)), support);
+    }
+}
@@ -27,6 +27,7 @@
 /// THE SOFTWARE.
 
 #include <gtest/gtest.h>
+#include <memory_resource>
 #include <ranges>
 #include <writer.h>
 #include "itemset.h"
@@ -127,3 +128,114 @@ INSTANTIATE_TEST_SUITE_P(
         get_algorithm(algorithm_t::ECLAT),
         get_algorithm(algorithm_t::RELIM))
 );
+
+TEST_P(FrequentItemsetTests, ApplyAlgorithmOnWeightedDatabase) {
+    auto duplicated_db = get_database();
+    for (const auto &trans: get_database()) {
+        duplicated_db.push_back(trans);
+    }
+
+    const auto [db, item_counts] = duplicated_db.transaction_reduction(2 * min_support());
+    const auto [weighted_db, weighted_item_counts] = duplicated_db.transaction_reduction(
+        2 * min_support(), {.collapse_duplicates = true});
+
+    ASSERT_TRUE(weighted_db.is_weighted());
+    ASSERT_LT(weighted_db.size(), db.size());
+    ASSERT_EQ(weighted_db.get_total_weight(), db.size());
+    ASSERT_EQ(weighted_item_counts, item_counts);
+
+    const auto compare = item_counts.get_item_compare();
+    auto freq_items = get_algorthm()({db, item_counts}, 2 * min_support()).sort_each_itemset(compare);
+    auto weighted_freq_items = get_algorthm()({weighted_db, weighted_item_counts}, 2 * min_support())
+            .sort_each_itemset(compare);
+
+    std::ranges::sort(freq_items);
+    std::ranges::sort(weighted_freq_items);
+
+    EXPECT_EQ(freq_items.size(), 35);
+    EXPECT_EQ(weighted_freq_items, freq_items);
+}
+
+class SinkAlgorithmTests : public testing::TestWithParam<algorithm_t> {
+protected:
+    // A memory resource that counts the allocated and the outstanding bytes.
+    struct counting_resource_t : std::pmr::memory_resource {
+        size_t allocated{0};
+        size_t outstanding{0};
+
+    private:
+        auto do_allocate(const size_t bytes, const size_t alignment) -> void * override {
+            allocated += bytes;
+            outstanding += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        auto do_deallocate(void *p, const size_t bytes, const size_t alignment) -> void override {
+            outstanding -= bytes;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] auto do_is_equal(const memory_resource &other) const noexcept -> bool override {
+            return this == &other;
+        }
+    };
+};
+
+TEST_P(SinkAlgorithmTests, ApplySinkAlgorithm) {
+    const database_t database{
+        {3, 1, 4, 2, 6, 7, 8}, {3, 4, 2, 5, 6, 7}, {1, 4, 5, 6, 7}, {1, 8, 4}, {1, 4, 5},
+        {1, 7}, {1, 3, 4, 2, 5, 6, 7}, {8}, {1, 3, 4, 6}, {1, 3, 2, 5, 6, 7}
+    };
+    const auto [db, item_counts] = database.transaction_reduction(4);
+    const auto compare = item_counts.get_item_compare();
+
+    // the sink receives the same itemsets as the returned collection, together with their support
+    itemsets_t freq_items{};
+    counts_t supports{};
+    counting_resource_t resource{};
+    const auto sink = [&](const transaction_t &itemset, const size_t support) {
+        freq_items.push_back(itemset.to_itemset().sort_itemset(compare));
+        supports.push_back(support);
+    };
+    get_sink_algorithm(GetParam())({db, item_counts}, 4, sink, &resource);
+    ASSERT_EQ(freq_items.size(), 35);
+
+    // the data structures of the algorithms are allocated from the resource and are all released again
+    EXPECT_EQ(resource.allocated > 0, GetParam() != algorithm_t::APRIORI);
+    EXPECT_EQ(resource.outstanding, 0);
+
+    const auto &counts = itemset_counts_t::create_itemset_counts(db, freq_items, compare);
+    EXPECT_EQ(counts.get_counts(freq_items), supports);
+
+    auto expected = get_algorithm(GetParam())({db, item_counts}, 4).sort_each_itemset(compare);
+    const auto itemset_less = [&](const itemset_t &x, const itemset_t &y) {
+        return x.size() != y.size() ? x.size() < y.size() : lexicographical_compare(x, y, compare);
+    };
+    std::ranges::sort(freq_items, itemset_less);
+    std::ranges::sort(expected, itemset_less);
+    EXPECT_EQ(freq_items, expected);
+}
+
+TEST_P(SinkAlgorithmTests, ApplyCountingAlgorithm) {
+    const database_t database{
+        {3, 1, 4, 2, 6, 7, 8}, {3, 4, 2, 5, 6, 7}, {1, 4, 5, 6, 7}, {1, 8, 4}, {1, 4, 5},
+        {1, 7}, {1, 3, 4, 2, 5, 6, 7}, {8}, {1, 3, 4, 6}, {1, 3, 2, 5, 6, 7}
+    };
+    const auto [db, item_counts] = database.transaction_reduction(4);
+    const auto compare = item_counts.get_item_compare();
+
+    // the returned counts equal those of a rescan of the database
+    auto [freq_items, supports] = get_counting_algorithm(GetParam())({db, item_counts}, 4);
+    freq_items.sort_each_itemset(compare);
+    ASSERT_EQ(freq_items.size(), 35);
+    ASSERT_EQ(supports.size(), 35);
+
+    const auto &counts = itemset_counts_t::create_itemset_counts(db, freq_items, compare);
+    EXPECT_EQ(counts.get_counts(freq_items), supports);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SinkAlgorithmTests,
+    SinkAlgorithmTests,
+    ::testing::Values(algorithm_t::APRIORI, algorithm_t::FP_GROWTH, algorithm_t::ECLAT, algorithm_t::RELIM)
+);
@@ -0,0 +1,97 @@
+/// @file huge_page_resource_tests.cpp
+/// @brief Unit tests for the memory resource backed by huge pages.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2023 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "algorithms.h"
+#include "huge_page_resource.h"
+
+using namespace fim;
+using namespace fim::algorithm;
+
+class HugePageResourceTests : public testing::Test {
+};
+
+TEST_F(HugePageResourceTests, AllocateTest) {
+    huge_page_resource_t resource{huge_page_resource_t::huge_page_size};
+    EXPECT_EQ(resource.mapped_bytes(), 0);
+
+    // the blocks are aligned, writable and don't overlap
+    std::vector<std::pair<std::byte *, size_t> > blocks{};
+    for (size_t i = 1; i < 1000; ++i) {
+        const auto size = i % 97 + 1;
+        const auto alignment = size_t{1} << (i % 7);
+        const auto p = static_cast<std::byte *>(resource.allocate(size, alignment));
+
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0);
+        std::memset(p, static_cast<int>(i), size);
+        blocks.emplace_back(p, size);
+    }
+    for (size_t i = 1; i < 1000; ++i) {
+        const auto &[p, size] = blocks[i - 1];
+        for (size_t j = 0; j < size; ++j) {
+            EXPECT_EQ(p[j], static_cast<std::byte>(i));
+        }
+    }
+
+    // a block larger than a chunk is mapped separately
+    const auto large_size = 3 * huge_page_resource_t::huge_page_size;
+    const auto large = resource.allocate(large_size);
+    std::memset(large, 1, large_size);
+    EXPECT_GE(resource.mapped_bytes() + resource.upstream_bytes(), large_size);
+
+    // a deallocated block is reused by the next allocation of the same size
+    const auto p = resource.allocate(48);
+    resource.deallocate(p, 48);
+    EXPECT_EQ(resource.allocate(48), p);
+
+    // at most the mapped chunks are backed by huge pages
+    EXPECT_LE(resource.huge_pages(), resource.mapped_bytes() / huge_page_resource_t::huge_page_size);
+}
+
+TEST_F(HugePageResourceTests, ApplyAlgorithmsTest) {
+    const database_t database{
+        {3, 1, 4, 2, 6, 7, 8}, {3, 4, 2, 5, 6, 7}, {1, 4, 5, 6, 7}, {1, 8, 4}, {1, 4, 5},
+        {1, 7}, {1, 3, 4, 2, 5, 6, 7}, {8}, {1, 3, 4, 6}, {1, 3, 2, 5, 6, 7}
+    };
+    const auto [db, item_counts] = database.transaction_reduction(4);
+
+    // the algorithms find the same itemsets with their structures allocated from huge pages
+    for (const auto algorithm: {algorithm_t::FP_GROWTH, algorithm_t::ECLAT, algorithm_t::RELIM}) {
+        huge_page_resource_t resource{};
+        const auto &[freq_items, counts] = get_counting_algorithm(algorithm, &resource)({db, item_counts}, 4);
+        const auto &[expected_items, expected_counts] = get_counting_algorithm(algorithm)({db, item_counts}, 4);
+
+        EXPECT_EQ(freq_items, expected_items);
+        EXPECT_EQ(counts, expected_counts);
+        EXPECT_GT(resource.mapped_bytes() + resource.upstream_bytes(), 0);
+    }
+}
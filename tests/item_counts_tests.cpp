@@ -27,6 +27,7 @@
 /// THE SOFTWARE.
 
 #include <gtest/gtest.h>
+#include <limits>
 #include <ranges>
 #include "itemset.h"
 #include "database.h"
@@ -184,3 +185,145 @@ TEST_F(ItemsetCountsTests, ItemCompareReverseTest) {
     EXPECT_TRUE(compare(2, 8));
     EXPECT_FALSE(compare(8, 2));
 }
+
+TEST_F(ItemsetCountsTests, ItemRanksTest) {
+    const auto &counts = get_database().get_item_counts();
+    const auto &ranks = item_ranks_t::create(counts, min_support());
+    const auto compare = counts.get_item_compare();
+
+    ASSERT_EQ(ranks.size(), 7);
+
+    // the rank order equals the item order
+    for (rank_t i = 0; i < ranks.size(); ++i) {
+        for (rank_t j = 0; j < ranks.size(); ++j) {
+            EXPECT_EQ(i < j, compare(ranks.get_item(i), ranks.get_item(j)));
+        }
+        EXPECT_EQ(ranks.get_rank(ranks.get_item(i)), i);
+    }
+
+    EXPECT_EQ(ranks.to_items(itemset_t{0, 5, 6}), itemset_t({2, 4, 1}));
+    EXPECT_EQ(ranks.to_items(itemsets_t{{0}, {5, 6}}), itemsets_t({{2}, {4, 1}}));
+
+    const auto &rank_counts = ranks.get_rank_counts();
+    EXPECT_TRUE(rank_counts.ranked);
+    EXPECT_TRUE(rank_counts.get_item_compare()(3, 4));
+    EXPECT_FALSE(rank_counts.get_item_compare()(4, 3));
+}
+
+TEST_F(ItemsetCountsTests, DenseItemCountsTest) {
+    // a database large enough to be counted by several threads
+    database_t db{};
+    for (size_t i = 0; i < 100000; ++i) {
+        db.push_back(itemset_t{static_cast<item_t>(i % 10), static_cast<item_t>(i % 7 + 10),
+                               static_cast<item_t>(i % 100 + 20)}, i % 3 + 1);
+    }
+
+    // the same database with items too large for a dense array of counters (if the item width allows for them)
+    constexpr item_t offset = std::numeric_limits<item_t>::max() / 2;
+    database_t sparse_db{};
+    for (size_t i = 0; i < db.size(); ++i) {
+        sparse_db.push_back(db[i].to_itemset() | transform([](const item_t &item) { return item + offset; })
+                            | std::ranges::to<itemset_t>(), db.get_weight(i));
+    }
+
+    const auto sparse_counts = sparse_db.get_item_counts();
+    for (const auto num_threads: {1, 4}) {
+        const auto counts = db.get_item_counts(num_threads);
+
+        ASSERT_EQ(counts.size(), sparse_counts.size());
+        for (const auto &[item, count]: counts) {
+            EXPECT_EQ(count, sparse_counts.at(item + offset));
+        }
+    }
+
+    // each transaction contains exactly one of the items 0, ..., 9
+    const auto counts = db.get_item_counts();
+    size_t total = 0;
+    for (item_t item = 0; item < 10; ++item) {
+        total += counts.at(item);
+    }
+    EXPECT_EQ(total, db.get_total_weight());
+
+    // the largest item has no successor, so its universe is not dense
+    constexpr auto max_item = std::numeric_limits<item_t>::max();
+    const database_t max_db{{0, max_item}, {max_item}};
+    const auto max_counts = max_db.get_item_counts(4);
+    ASSERT_EQ(max_counts.size(), 2);
+    EXPECT_EQ(max_counts.at(0), 1);
+    EXPECT_EQ(max_counts.at(max_item), 2);
+}
+
+TEST_F(ItemsetCountsTests, ItemsetCountsTableTest) {
+    itemset_counts_t counts{};
+    EXPECT_TRUE(counts.empty());
+    EXPECT_FALSE(counts.contains(itemset_t{1, 2}));
+
+    // enough itemsets (of different lengths) to grow the table several times
+    itemsets_t itemsets{};
+    for (item_t i = 0; i < 1000; ++i) {
+        itemsets.emplace_back(std::views::iota(i, static_cast<item_t>(i + i % 12 + 1)) | std::ranges::to<itemset_t>());
+    }
+
+    for (size_t i = 0; i < itemsets.size(); ++i) {
+        counts[itemsets[i]] += i;
+    }
+    counts[itemsets[1]] += 10;
+
+    ASSERT_EQ(counts.size(), itemsets.size());
+    EXPECT_EQ(counts.at(itemsets[1]), 11);
+    EXPECT_EQ(counts.get_count(itemset_t{1000, 1001}), 0);
+    EXPECT_THROW(static_cast<void>(counts.at(itemset_t{1000, 1001})), std::out_of_range);
+
+    itemsets.emplace_back(itemset_t{1000, 1001});
+    const auto batch_counts = counts.get_counts(itemsets);
+
+    ASSERT_EQ(batch_counts.size(), itemsets.size());
+    for (size_t i = 0; i < itemsets.size() - 1; ++i) {
+        EXPECT_EQ(counts.get_itemset(counts.find(itemsets[i]).value()), itemsets[i]);
+        EXPECT_EQ(batch_counts[i], i == 1 ? 11 : i);
+    }
+    EXPECT_EQ(batch_counts.back(), 0);
+}
+
+TEST_F(ItemsetCountsTests, PairCountsTest) {
+    const auto &[db, rank_counts, item_ranks] = get_database().rank_reduction(1, {.collapse_duplicates = true});
+    ASSERT_EQ(rank_counts.size(), 8);
+
+    auto count_pair = [&](const item_t x, const item_t y) {
+        size_t count = 0;
+        for (size_t i = 0; i < db.size(); ++i) {
+            const auto transaction = db[i];
+            if (std::ranges::binary_search(transaction, x) && std::ranges::binary_search(transaction, y)) {
+                count += db.get_weight(i);
+            }
+        }
+        return count;
+    };
+
+    for (const size_t num_ranks: {0, 1, 5, 8}) {
+        const pair_counts_t pair_counts{db, num_ranks};
+        for (item_t x = 0; x < num_ranks; ++x) {
+            for (auto y = static_cast<item_t>(x + 1); y < num_ranks; ++y) {
+                EXPECT_EQ(pair_counts.get_count(x, y), count_pair(x, y));
+            }
+        }
+
+        // the frequent pairs are in lexicographical order
+        const auto &[pairs, supports] = pair_counts.get_frequent_pairs(min_support());
+        ASSERT_EQ(pairs.size(), supports.size());
+        EXPECT_TRUE(std::ranges::is_sorted(pairs, std::ranges::lexicographical_compare));
+        size_t num_pairs = 0;
+        for (item_t x = 0; x < num_ranks; ++x) {
+            for (auto y = static_cast<item_t>(x + 1); y < num_ranks; ++y) {
+                num_pairs += count_pair(x, y) >= min_support() ? 1 : 0;
+            }
+        }
+        EXPECT_EQ(pairs.size(), num_pairs);
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            EXPECT_EQ(supports[i], count_pair(pairs[i][0], pairs[i][1]));
+        }
+    }
+
+    EXPECT_TRUE(pair_counts_t::fits(1000));
+    EXPECT_FALSE(pair_counts_t::fits(100000));
+}
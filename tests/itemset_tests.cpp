@@ -96,6 +96,19 @@ TEST_F(ItemsetTests, IsSubsetMemberTest) {
     EXPECT_FALSE(itemset_t({7, 1}).is_subset({1, 5, 6}));
 }
 
+TEST_F(ItemsetTests, RankCompareTest) {
+    constexpr auto compare = rank_compare_t{};
+
+    EXPECT_TRUE(itemset_t({7, 1, 4}).sort_itemset(compare) == itemset_t({1, 4, 7}));
+    EXPECT_TRUE(itemset_t({1, 7}).is_subset({1, 4, 7}, compare));
+    EXPECT_FALSE(itemset_t({1, 5}).is_subset({1, 4, 7}, compare));
+
+    EXPECT_TRUE(lexicographical_compare({1, 4}, {1, 5}, compare));
+    EXPECT_TRUE(lexicographical_compare({1, 4, 7}, {1, 4}, compare));
+    EXPECT_FALSE(lexicographical_compare({1, 4}, {1, 4}, compare));
+    EXPECT_FALSE(lexicographical_compare({2}, {1, 4}, compare));
+}
+
 TEST_F(ItemsetTests, SetDifferenceTest) {
     EXPECT_EQ(set_difference({1, 5, 2}, {1, 5, 2}), itemset_t{});
     EXPECT_EQ(set_difference({1, 5, 2}, {5}), itemset_t({1, 2}));
@@ -0,0 +1,95 @@
+/// @file itemset_trie_tests.cpp
+/// @brief Unit test for the prefix trie of itemsets.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2023 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "itemset_trie.h"
+
+using namespace fim;
+
+class ItemsetTrieTests : public testing::Test {
+protected:
+    // Creates the trie of {1}, {1, 2}, {1, 2, 3}, {1, 3}, {2} and {2, 3}.
+    static auto get_trie() -> itemset_trie_t {
+        itemset_trie_t trie{};
+        const auto node_1 = trie.add(itemset_trie_t::root, 1, 6);
+        const auto node_12 = trie.add(node_1, 2, 4);
+        trie.add(node_12, 3, 2);
+        trie.add(node_1, 3, 3);
+        const auto node_2 = trie.add(itemset_trie_t::root, 2, 5);
+        trie.add(node_2, 3, 3);
+        return trie;
+    }
+};
+
+TEST_F(ItemsetTrieTests, AddTest) {
+    const auto trie = get_trie();
+
+    ASSERT_EQ(trie.size(), 6);
+    EXPECT_EQ(trie.get_itemset(0), (itemset_t{1}));
+    EXPECT_EQ(trie.get_itemset(2), (itemset_t{1, 2, 3}));
+    EXPECT_EQ(trie.get_itemset(3), (itemset_t{1, 3}));
+    EXPECT_EQ(trie.get_itemset(5), (itemset_t{2, 3}));
+
+    EXPECT_EQ(trie.get_support(0), 6);
+    EXPECT_EQ(trie.get_support(2), 2);
+    EXPECT_EQ(trie.get_support(5), 3);
+}
+
+TEST_F(ItemsetTrieTests, IteratorTest) {
+    const auto trie = get_trie();
+
+    std::vector<itemset_t> itemsets{};
+    std::vector<size_t> supports{};
+    for (const auto &[itemset, support]: trie) {
+        itemsets.push_back(itemset);
+        supports.push_back(support);
+    }
+
+    EXPECT_EQ(itemsets, (std::vector<itemset_t>{{1}, {1, 2}, {1, 2, 3}, {1, 3}, {2}, {2, 3}}));
+    EXPECT_EQ(supports, (std::vector<size_t>{6, 4, 2, 3, 5, 3}));
+}
+
+TEST_F(ItemsetTrieTests, ToItemsetsTest) {
+    const auto trie = get_trie();
+    const auto itemsets = trie.to_itemsets();
+
+    ASSERT_EQ(itemsets.size(), trie.size());
+    for (size_t i = 0; i < trie.size(); ++i) {
+        EXPECT_EQ(itemsets[i], trie.get_itemset(i));
+    }
+}
+
+TEST_F(ItemsetTrieTests, TransformItemsTest) {
+    auto trie = get_trie();
+    trie.transform_items([](const item_t &item) { return 10 * item; }, 4);
+
+    EXPECT_EQ(trie.get_itemset(2), (itemset_t{1, 2, 3}));
+    EXPECT_EQ(trie.get_itemset(4), (itemset_t{20}));
+    EXPECT_EQ(trie.get_itemset(5), (itemset_t{20, 30}));
+}
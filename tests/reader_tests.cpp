@@ -28,6 +28,8 @@
 
 #include <gtest/gtest.h>
 #include <fstream>
+#include <limits>
+#include <string>
 #include "itemset.h"
 #include "reader.h"
 
@@ -62,6 +64,20 @@ TEST_F(ReaderTests, ReadCsvInvalidFormatTest) {
     EXPECT_EQ(result.error(), io_error_t::INVALID_FORMAT);
 }
 
+TEST_F(ReaderTests, ReadCsvValueOutOfRangeTest) {
+    // the largest item fits into the item width, the next larger value does not
+    const auto max_item = static_cast<unsigned long long>(std::numeric_limits<item_t>::max());
+    std::istringstream valid("1 " + std::to_string(max_item));
+    const auto &result = read_csv(valid);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value()[0], itemset_t({1, std::numeric_limits<item_t>::max()}));
+
+    std::istringstream iss("1 2 3\n1 " + std::to_string(max_item) + "0");
+    const auto &out_of_range = read_csv(iss);
+    ASSERT_FALSE(out_of_range.has_value());
+    EXPECT_EQ(out_of_range.error(), io_error_t::VALUE_OUT_OF_RANGE);
+}
+
 TEST_F(ReaderTests, ReadCsvBadErrorTest) {
     std::istringstream iss;
     iss.setstate(std::ios::badbit);
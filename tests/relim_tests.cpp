@@ -369,3 +369,19 @@ TEST_F(RelimTests, RelimAlgorithmTest) {
     EXPECT_TRUE(verify({'e', 'c', 'd'}, 2));
     EXPECT_TRUE(verify({'c', 'b', 'd'}, 2));
 }
+
+TEST_F(RelimTests, RelimTrieTest) {
+    const auto [db, item_counts] = get_database().transaction_reduction(min_support());
+    const auto compare = item_counts.get_item_compare();
+
+    const auto &trie = relim_trie(db, min_support());
+    ASSERT_EQ(trie.size(), 17);
+
+    // the trie holds the same itemsets as the flat result together with their support
+    const auto &freq_items = trie.to_itemsets().sort_each_itemset(compare);
+    const auto &counts = itemset_counts_t::create_itemset_counts(db, freq_items, compare);
+
+    for (const auto &[itemset, support]: trie) {
+        EXPECT_EQ(counts.get_count(itemset.sort_itemset(compare)), support);
+    }
+}
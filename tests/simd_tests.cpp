@@ -0,0 +1,106 @@
+/// @file simd_tests.cpp
+/// @brief Unit test for the vectorized kernels.
+///
+/// @author Roland Abel
+/// @date October 16, 2026
+///
+/// Copyright (c) 2023 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+#include "simd.h"
+
+using namespace fim;
+
+template<typename T>
+class SimdTests : public testing::Test {
+protected:
+    // Creates random arrays of distinct sorted elements of all sizes up to a few blocks, dense and sparse ones.
+    static auto create_arrays() -> std::vector<std::vector<T> > {
+        std::mt19937 generator{42};
+        std::vector<std::vector<T> > arrays{};
+
+        for (size_t size = 0; size < 40; ++size) {
+            for (const T max_value: {T{8}, T{64}, std::numeric_limits<T>::max()}) {
+                std::uniform_int_distribution<T> distribution{0, max_value};
+                std::vector<T> array(size);
+                std::ranges::generate(array, [&] { return distribution(generator); });
+                std::ranges::sort(array);
+                array.erase(std::ranges::unique(array).begin(), array.end());
+                arrays.push_back(std::move(array));
+            }
+        }
+        return arrays;
+    }
+};
+
+using element_types = testing::Types<std::uint16_t, std::uint32_t, std::uint64_t>;
+TYPED_TEST_SUITE(SimdTests, element_types);
+
+TYPED_TEST(SimdTests, IncludesTest) {
+    const auto arrays = TestFixture::create_arrays();
+    for (const auto &x: arrays) {
+        for (const auto &y: arrays) {
+            EXPECT_EQ(simd::includes<TypeParam>(y, x), std::ranges::includes(y, x));
+        }
+
+        // every subsequence of an array is included
+        std::vector<TypeParam> subset{};
+        for (size_t i = 0; i < x.size(); i += 3) {
+            subset.push_back(x[i]);
+        }
+        EXPECT_TRUE(simd::includes<TypeParam>(x, subset));
+    }
+}
+
+TYPED_TEST(SimdTests, LexicographicalCompareTest) {
+    const auto arrays = TestFixture::create_arrays();
+    for (const auto &x: arrays) {
+        for (const auto &y: arrays) {
+            const auto [it_x, it_y] = std::ranges::mismatch(x, y);
+            const auto expected = it_x != x.end() && it_y != y.end() ? *it_x < *it_y : x.size() > y.size();
+
+            EXPECT_EQ(simd::mismatch<TypeParam>(x, y), static_cast<size_t>(it_x - x.begin()));
+            EXPECT_EQ(simd::lexicographical_compare<TypeParam>(x, y), expected);
+        }
+    }
+}
+
+TYPED_TEST(SimdTests, SetDifferenceTest) {
+    const auto arrays = TestFixture::create_arrays();
+    for (const auto &x: arrays) {
+        for (const auto &y: arrays) {
+            std::vector<TypeParam> expected{};
+            std::ranges::set_difference(x, y, std::back_inserter(expected));
+
+            std::vector<TypeParam> difference{};
+            simd::set_difference<TypeParam>(x, y, std::back_inserter(difference));
+            EXPECT_EQ(difference, expected);
+        }
+    }
+}
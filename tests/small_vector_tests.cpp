@@ -0,0 +1,117 @@
+/// @file small_vector_tests.cpp
+/// @brief Unit test for the small vector.
+///
+/// @author Roland Abel
+/// @date October 15, 2026
+///
+/// Copyright (c) 2023 Roland Abel
+///
+/// This software is released under the MIT License.
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// with the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <ranges>
+#include "small_vector.h"
+
+using namespace fim;
+
+class SmallVectorTests : public testing::Test {
+protected:
+    using vector_t = small_vector<unsigned long, 4>;
+
+    static vector_t get_vector(const size_t size) {
+        vector_t vector{};
+        for (size_t i = 0; i < size; ++i) {
+            vector.push_back(i);
+        }
+        return vector;
+    }
+};
+
+TEST_F(SmallVectorTests, InlineStorageTest) {
+    auto vector = get_vector(4);
+
+    EXPECT_TRUE(vector.is_inline());
+    EXPECT_EQ(vector.size(), 4);
+    EXPECT_EQ(vector.capacity(), 4);
+    EXPECT_EQ(vector, vector_t({0, 1, 2, 3}));
+}
+
+TEST_F(SmallVectorTests, SpillToHeapTest) {
+    auto vector = get_vector(5);
+
+    EXPECT_FALSE(vector.is_inline());
+    EXPECT_EQ(vector.size(), 5);
+    EXPECT_GE(vector.capacity(), 5);
+    EXPECT_EQ(vector, vector_t({0, 1, 2, 3, 4}));
+
+    vector.push_back(vector.front());
+    EXPECT_EQ(vector.back(), 0);
+}
+
+TEST_F(SmallVectorTests, CopyAndMoveTest) {
+    for (const size_t size: {2, 9}) {
+        const auto vector = get_vector(size);
+
+        auto copy = vector;
+        EXPECT_EQ(copy, vector);
+
+        auto moved = std::move(copy);
+        EXPECT_EQ(moved, vector);
+        EXPECT_TRUE(copy.empty());
+
+        copy = moved;
+        EXPECT_EQ(copy, vector);
+
+        moved = get_vector(1);
+        EXPECT_EQ(moved, vector_t{0});
+    }
+}
+
+TEST_F(SmallVectorTests, InsertAndEraseTest) {
+    auto vector = vector_t{1, 5};
+
+    vector.insert(vector.begin() + 1, 3);
+    EXPECT_EQ(vector, vector_t({1, 3, 5}));
+
+    const auto items = std::vector<unsigned long>{7, 8, 9};
+    vector.insert(vector.end(), items.begin(), items.end());
+    EXPECT_EQ(vector, vector_t({1, 3, 5, 7, 8, 9}));
+
+    vector.erase(vector.begin());
+    EXPECT_EQ(vector, vector_t({3, 5, 7, 8, 9}));
+
+    EXPECT_EQ(erase_if(vector, [](const auto &x) { return x % 2 == 1; }), 4);
+    EXPECT_EQ(vector, vector_t{8});
+}
+
+TEST_F(SmallVectorTests, CompareTest) {
+    EXPECT_LT(vector_t({1, 2}), vector_t({1, 3}));
+    EXPECT_LT(vector_t({1, 2}), vector_t({1, 2, 0}));
+    EXPECT_NE(vector_t({1, 2}), vector_t({2, 1}));
+    EXPECT_EQ(vector_t{}, vector_t{});
+}
+
+TEST_F(SmallVectorTests, RangesTest) {
+    const auto vector = std::views::iota(0ul, 6ul) | std::ranges::to<vector_t>();
+
+    EXPECT_EQ(vector, vector_t({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(vector_t(3, 7), vector_t({7, 7, 7}));
+}
@@ -104,3 +104,21 @@ TEST_F(WriterTests, WriterCsvWithHeaderTest) {
     EXPECT_EQ(get_next_line(iss), "5,3 4 6 7 8,6.4");
     EXPECT_EQ(get_next_line(iss), "4,2 3 7 8,7.3");
 }
+
+TEST_F(WriterTests, WriterCsvFromTrieTest) {
+    itemset_trie_t trie{};
+    const auto node = trie.add(itemset_trie_t::root, 6, 3);
+    trie.add(node, 7, 2);
+    trie.add(itemset_trie_t::root, 8, 1);
+
+    std::ostringstream oss;
+    const auto &result = to_csv(oss, trie, 4, write_csv_config_t{true, ','});
+
+    ASSERT_TRUE(result.has_value());
+    std::istringstream iss(oss.str());
+
+    EXPECT_EQ(get_next_line(iss), "length,itemset,support");
+    EXPECT_EQ(get_next_line(iss), "1,6,0.75");
+    EXPECT_EQ(get_next_line(iss), "2,6 7,0.5");
+    EXPECT_EQ(get_next_line(iss), "1,8,0.25");
+}